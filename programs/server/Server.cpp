@@ -201,6 +201,7 @@ namespace ServerSetting
     extern const ServerSettingsDouble cannot_allocate_thread_fault_injection_probability;
     extern const ServerSettingsUInt64 cgroups_memory_usage_observer_wait_time;
     extern const ServerSettingsUInt64 compiled_expression_cache_elements_size;
+    extern const ServerSettingsString compiled_expression_cache_path;
     extern const ServerSettingsUInt64 compiled_expression_cache_size;
     extern const ServerSettingsUInt64 concurrent_threads_soft_limit_num;
     extern const ServerSettingsUInt64 concurrent_threads_soft_limit_ratio_to_cores;
@@ -242,6 +243,7 @@ namespace ServerSetting
     extern const ServerSettingsSeconds keep_alive_timeout;
     extern const ServerSettingsString mark_cache_policy;
     extern const ServerSettingsUInt64 mark_cache_size;
+    extern const ServerSettingsUInt64 mark_cache_compressed_size;
     extern const ServerSettingsDouble mark_cache_size_ratio;
     extern const ServerSettingsUInt64 max_fetch_partition_thread_pool_size;
     extern const ServerSettingsUInt64 max_active_parts_loading_thread_pool_size;
@@ -1752,7 +1754,8 @@ try
         mark_cache_size = max_cache_size;
         LOG_INFO(log, "Lowered mark cache size to {} because the system has limited RAM", formatReadableSizeWithBinarySuffix(mark_cache_size));
     }
-    global_context->setMarkCache(mark_cache_policy, mark_cache_size, mark_cache_size_ratio);
+    size_t mark_cache_compressed_size = server_settings[ServerSetting::mark_cache_compressed_size];
+    global_context->setMarkCache(mark_cache_policy, mark_cache_size, mark_cache_compressed_size, mark_cache_size_ratio);
 
     String primary_index_cache_policy = server_settings[ServerSetting::primary_index_cache_policy];
     size_t primary_index_cache_size = server_settings[ServerSetting::primary_index_cache_size];
@@ -1841,6 +1844,10 @@ try
     size_t compiled_expression_cache_max_size_in_bytes = server_settings[ServerSetting::compiled_expression_cache_size];
     size_t compiled_expression_cache_max_elements = server_settings[ServerSetting::compiled_expression_cache_elements_size];
     CompiledExpressionCacheFactory::instance().init(compiled_expression_cache_max_size_in_bytes, compiled_expression_cache_max_elements);
+
+    String compiled_expression_cache_path = server_settings[ServerSetting::compiled_expression_cache_path];
+    if (!compiled_expression_cache_path.empty())
+        CompiledExpressionCacheFactory::instance().initPersistentStorage(compiled_expression_cache_path);
 #endif
 
     NamedCollectionFactory::instance().loadIfNot();
@@ -74,20 +74,36 @@ public:
 
     std::shared_ptr<const ContextAccess> getContextAccess(const ContextAccessParams & params)
     {
-        std::lock_guard lock{mutex};
-        auto x = cache.get(params);
-        if (x)
         {
-            if ((*x)->getUserID() && !(*x)->tryGetUser())
-                cache.remove(params); /// The user has been dropped while it was in the cache.
-            else
-                return *x;
+            std::lock_guard lock{mutex};
+            auto x = cache.get(params);
+            if (x)
+            {
+                if ((*x)->getUserID() && !(*x)->tryGetUser())
+                    cache.remove(params); /// The user has been dropped while it was in the cache.
+                else
+                    return *x;
+            }
         }
 
-        /// TODO: There is no need to keep the `ContextAccessCache::mutex` locked while we're calculating access rights.
+        /// Calculating the access rights is the expensive part for setups with many grants;
+        /// do it without holding the cache mutex, otherwise every session entering the cache
+        /// is serialized behind it. Concurrent sessions with the same params may compute the
+        /// rights twice; the first inserted result wins.
         auto res = std::make_shared<ContextAccess>(access_control, params);
         res->initialize();
-        cache.add(params, res);
+
+        {
+            std::lock_guard lock{mutex};
+            if (auto x = cache.get(params))
+            {
+                if (!((*x)->getUserID() && !(*x)->tryGetUser()))
+                    return *x;
+                cache.remove(params);
+            }
+            cache.add(params, res);
+        }
+
         return res;
     }
 
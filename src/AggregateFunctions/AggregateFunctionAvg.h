@@ -253,6 +253,15 @@ public:
         ++this->data(place).denominator;
     }
 
+    /// See AggregateFunctionSum: exact only when the numerator is not floating point.
+    bool canRemoveData() const override { return !std::is_floating_point_v<Numerator>; }
+
+    void remove(AggregateDataPtr __restrict place, const IColumn ** columns, size_t row_num, Arena *) const override
+    {
+        increment(place, -Numerator(static_cast<const ColVecType &>(*columns[0]).getData()[row_num]));
+        --this->data(place).denominator;
+    }
+
     void addManyDefaults(
         AggregateDataPtr __restrict place,
         const IColumn ** /*columns*/,
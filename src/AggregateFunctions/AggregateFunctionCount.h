@@ -56,6 +56,13 @@ public:
         ++data(place).count;
     }
 
+    bool canRemoveData() const override { return true; }
+
+    void remove(AggregateDataPtr __restrict place, const IColumn **, size_t, Arena *) const override
+    {
+        --data(place).count;
+    }
+
     void addManyDefaults(
         AggregateDataPtr __restrict place,
         const IColumn ** /*columns*/,
@@ -235,6 +242,13 @@ public:
         data(place).count += !assert_cast<const ColumnNullable &>(*columns[0]).isNullAt(row_num);
     }
 
+    bool canRemoveData() const override { return true; }
+
+    void remove(AggregateDataPtr __restrict place, const IColumn ** columns, size_t row_num, Arena *) const override
+    {
+        data(place).count -= !assert_cast<const ColumnNullable &>(*columns[0]).isNullAt(row_num);
+    }
+
     void addBatchSinglePlace(
         size_t row_begin,
         size_t row_end,
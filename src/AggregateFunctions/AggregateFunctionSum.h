@@ -491,6 +491,19 @@ public:
         this->data(place).add(static_cast<TResult>(column.getData()[row_num]));
     }
 
+    /// Addition is modular for integers and Decimals, so previously added rows can be retired
+    /// exactly by adding the negated value. Floating point stays non-removable: addition is not
+    /// associative, and the cancellation residue would accumulate over a sliding partition
+    /// (the recompute path is exact per frame). Kahan summation keeps a compensation term that
+    /// is not reversible either.
+    bool canRemoveData() const override { return Type != AggregateFunctionTypeSumKahan && !std::is_floating_point_v<T>; }
+
+    void remove(AggregateDataPtr __restrict place, const IColumn ** columns, size_t row_num, Arena *) const override
+    {
+        const auto & column = assert_cast<const ColVecType &>(*columns[0]);
+        this->data(place).add(-static_cast<TResult>(column.getData()[row_num]));
+    }
+
     void addBatchSinglePlace(
         size_t row_begin,
         size_t row_end,
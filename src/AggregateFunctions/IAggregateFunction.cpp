@@ -132,6 +132,11 @@ void IAggregateFunction::predictValues(
     throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Method predictValues is not supported for {}", getName());
 }
 
+void IAggregateFunction::remove(AggregateDataPtr __restrict /*place*/, const IColumn ** /*columns*/, size_t /*row_num*/, Arena * /*arena*/) const
+{
+    throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Method remove is not supported for {}", getName());
+}
+
 #if USE_EMBEDDED_COMPILER
 
 void IAggregateFunction::compileCreate(llvm::IRBuilderBase & /*builder*/, llvm::Value * /*aggregate_data_ptr*/) const
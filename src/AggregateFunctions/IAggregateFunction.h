@@ -2,6 +2,7 @@
 
 #include <AggregateFunctions/IAggregateFunction_fwd.h>
 #include <Columns/ColumnSparse.h>
+#include <Columns/ColumnsCommon.h>
 #include <Columns/ColumnTuple.h>
 #include <Columns/ColumnsNumber.h>
 #include <Core/ColumnNumbers.h>
@@ -17,6 +18,7 @@
 #include "config.h"
 
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <vector>
 #include <type_traits>
@@ -131,6 +133,15 @@ public:
      */
     virtual void add(AggregateDataPtr __restrict place, const IColumn ** columns, size_t row_num, Arena * arena) const = 0;
 
+    /** Whether rows that were previously added to the state can be removed from it with the remove() method.
+      * Used to maintain sliding window frames incrementally instead of recomputing the whole frame.
+      */
+    virtual bool canRemoveData() const { return false; }
+
+    /// The reverse of add(). May be called only for rows that are currently accounted in the state
+    /// and only if canRemoveData() returns true.
+    virtual void remove(AggregateDataPtr __restrict place, const IColumn ** columns, size_t row_num, Arena * arena) const;
+
     /// Adds several default values of arguments into aggregation data on which place points to.
     /// Default values must be a the 0-th positions in columns.
     virtual void addManyDefaults(AggregateDataPtr __restrict place, const IColumn ** columns, size_t length, Arena * arena) const = 0;
@@ -437,10 +448,39 @@ public:
         if (if_argument_pos >= 0)
         {
             const auto & flags = assert_cast<const ColumnUInt8 &>(*columns[if_argument_pos]).getData();
-            for (size_t i = row_begin; i < row_end; ++i)
+
+            /// -If filters are often strongly skewed in practice. Resolve the dense and the empty case
+            /// with one vectorized scan, and process sparse filters word-by-word, skipping whole spans
+            /// of zero flags, instead of taking a data-dependent branch on every row.
+            const size_t num_set = countBytesInFilter(flags.data(), row_begin, row_end);
+            if (num_set == 0)
+                return;
+
+            if (num_set == row_end - row_begin)
             {
-                if (flags[i] && places[i])
-                    static_cast<const Derived *>(this)->add(places[i] + place_offset, columns, i, arena);
+                for (size_t i = row_begin; i < row_end; ++i)
+                    if (places[i])
+                        static_cast<const Derived *>(this)->add(places[i] + place_offset, columns, i, arena);
+                return;
+            }
+
+            for (size_t i = row_begin; i < row_end;)
+            {
+                UInt64 word;
+                if (i + 8 <= row_end)
+                {
+                    memcpy(&word, &flags[i], 8);
+                    if (!word)
+                    {
+                        i += 8;
+                        continue;
+                    }
+                }
+
+                size_t span_end = std::min(i + 8, row_end);
+                for (; i < span_end; ++i)
+                    if (flags[i] && places[i])
+                        static_cast<const Derived *>(this)->add(places[i] + place_offset, columns, i, arena);
             }
         }
         else
@@ -551,10 +591,36 @@ public:
         if (if_argument_pos >= 0)
         {
             const auto & flags = assert_cast<const ColumnUInt8 &>(*columns[if_argument_pos]).getData();
-            for (size_t i = row_begin; i < row_end; ++i)
+
+            /// See the comment in addBatch about skewed -If filters.
+            const size_t num_set = countBytesInFilter(flags.data(), row_begin, row_end);
+            if (num_set == 0)
+                return;
+
+            if (num_set == row_end - row_begin)
             {
-                if (flags[i])
+                for (size_t i = row_begin; i < row_end; ++i)
                     static_cast<const Derived *>(this)->add(place, columns, i, arena);
+                return;
+            }
+
+            for (size_t i = row_begin; i < row_end;)
+            {
+                UInt64 word;
+                if (i + 8 <= row_end)
+                {
+                    memcpy(&word, &flags[i], 8);
+                    if (!word)
+                    {
+                        i += 8;
+                        continue;
+                    }
+                }
+
+                size_t span_end = std::min(i + 8, row_end);
+                for (; i < span_end; ++i)
+                    if (flags[i])
+                        static_cast<const Derived *>(this)->add(place, columns, i, arena);
             }
         }
         else
@@ -250,6 +250,14 @@ void Connection::connect(const ConnectionTimeouts & timeouts)
                 TCP_KEEPIDLE  // __APPLE__
 #endif
                 , tcp_keep_alive_timeout_in_sec);
+
+#if defined(TCP_KEEPINTVL) && defined(TCP_KEEPCNT)
+            /// Probe a few times at a fraction of the idle timeout, so that connections broken by a
+            /// network blip are detected and evicted from pools while idle, instead of all failing
+            /// (and re-establishing TLS) at the moment the next queries try to use them.
+            socket->setOption(IPPROTO_TCP, TCP_KEEPINTVL, std::max(1, tcp_keep_alive_timeout_in_sec / 3));
+            socket->setOption(IPPROTO_TCP, TCP_KEEPCNT, 3);
+#endif
         }
 
         in = std::make_shared<ReadBufferFromPocoSocketChunked>(*socket);
@@ -208,6 +208,33 @@ void ColumnLowCardinality::doInsertRangeFrom(const IColumn & src, size_t start,
     {
         compactIfSharedDictionary();
 
+        const auto & src_dictionary_ptr = low_cardinality_src->getDictionaryPtr();
+
+        if (remapped_src_dictionary.get() == src_dictionary_ptr.get())
+        {
+            /// The same source dictionary is inserted from repeatedly (e.g. consecutive granules
+            /// of one part during a merge). Translate its whole key set once and then remap
+            /// indexes through the precomputed table instead of re-hashing keys per range.
+            /// The source dictionary object may have been appended to in place since the table
+            /// was built (dictionaries are not COW-protected), so also rebuild when its size
+            /// no longer matches the translated key count.
+            if (!src_dictionary_remapping || remapping_target != &getDictionary()
+                || remapped_src_dictionary_size != low_cardinality_src->getDictionary().size())
+            {
+                auto src_nested = low_cardinality_src->getDictionary().getNestedColumn();
+                src_dictionary_remapping = getDictionary().uniqueInsertRangeFrom(*src_nested, 0, src_nested->size());
+                remapping_target = &getDictionary();
+                remapped_src_dictionary_size = low_cardinality_src->getDictionary().size();
+            }
+
+            auto sub_idx = low_cardinality_src->getIndexes().cut(start, length);
+            idx.insertPositionsRange(*src_dictionary_remapping->index(*sub_idx, 0), 0, length);
+            return;
+        }
+
+        remapped_src_dictionary = src_dictionary_ptr;
+        src_dictionary_remapping = nullptr;
+
         /// TODO: Support native insertion from other unique column. It will help to avoid null map creation.
 
         auto sub_idx = IColumn::mutate(low_cardinality_src->getIndexes().cut(start, length));
@@ -416,6 +416,18 @@ private:
     Dictionary dictionary;
     Index idx;
 
+    /// Cached translation of a foreign dictionary's indexes into this dictionary.
+    /// Built when the same source dictionary object is seen in consecutive insertRangeFrom calls,
+    /// which is the common case during merges, where all granules of a source part share one dictionary.
+    /// remapped_src_dictionary also keeps the source dictionary alive, so the address cannot be reused.
+    ColumnPtr remapped_src_dictionary;
+    ColumnPtr src_dictionary_remapping;
+    const IColumnUnique * remapping_target = nullptr;
+    /// Number of source dictionary keys covered by the translation table. Low cardinality
+    /// dictionaries are not COW-protected, so the same object can grow in place between calls;
+    /// a size change invalidates the cached remapping.
+    size_t remapped_src_dictionary_size = 0;
+
     void compactInplace();
     void compactIfSharedDictionary();
 
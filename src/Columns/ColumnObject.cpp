@@ -1796,6 +1796,11 @@ void ColumnObject::fillPathColumnFromSharedData(IColumn & path_column, StringRef
     const auto & shared_data_paths = assert_cast<const ColumnString &>(shared_data_tuple.getColumn(0));
     const auto & shared_data_values = assert_cast<const ColumnString &>(shared_data_tuple.getColumn(1));
     const auto & dynamic_serialization = getDynamicSerialization();
+
+    /// Requested paths are often rare in shared data, so most rows produce a default value.
+    /// Batch the runs of defaults between matches into single insertManyDefaults calls instead
+    /// of doing a virtual insertDefault per row.
+    size_t num_defaults_to_insert = 0;
     for (size_t i = start; i != end; ++i)
     {
         size_t paths_start = shared_data_offsets[static_cast<ssize_t>(i) - 1];
@@ -1803,15 +1808,24 @@ void ColumnObject::fillPathColumnFromSharedData(IColumn & path_column, StringRef
         auto lower_bound_path_index = ColumnObject::findPathLowerBoundInSharedData(path, shared_data_paths, paths_start, paths_end);
         if (lower_bound_path_index != paths_end && shared_data_paths.getDataAt(lower_bound_path_index) == path)
         {
+            if (num_defaults_to_insert)
+            {
+                path_column.insertManyDefaults(num_defaults_to_insert);
+                num_defaults_to_insert = 0;
+            }
+
             auto value_data = shared_data_values.getDataAt(lower_bound_path_index);
             ReadBufferFromMemory buf(value_data.data, value_data.size);
             dynamic_serialization->deserializeBinary(path_column, buf, getFormatSettings());
         }
         else
         {
-            path_column.insertDefault();
+            ++num_defaults_to_insert;
         }
     }
+
+    if (num_defaults_to_insert)
+        path_column.insertManyDefaults(num_defaults_to_insert);
 }
 
 /// Class that allows to iterate over paths inside single row in ColumnObject in sorted order.
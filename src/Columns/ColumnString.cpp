@@ -513,16 +513,27 @@ size_t ColumnString::estimateCardinalityInPermutedRange(const Permutation & perm
     if (range_size <= 1)
         return range_size;
 
-    /// TODO use sampling if the range is too large (e.g. 16k elements, but configurable)
+    /// For large ranges, estimate the cardinality from an evenly spaced sample: hashing every
+    /// string of a big equal-range is itself as expensive as the sort step this estimate guides.
+    static constexpr size_t max_elements_to_hash = 16384;
+    const size_t step = range_size <= max_elements_to_hash ? 1 : range_size / max_elements_to_hash;
+
     StringHashSet elements;
     bool inserted = false;
-    for (size_t i = equal_range.from; i < equal_range.to; ++i)
+    size_t hashed = 0;
+    for (size_t i = equal_range.from; i < equal_range.to; i += step)
     {
         size_t permuted_i = permutation[i];
         StringRef value = getDataAt(permuted_i);
         elements.emplace(value, inserted);
+        ++hashed;
     }
-    return elements.size();
+
+    if (step == 1)
+        return elements.size();
+
+    /// Scale the sampled estimate back to the range, it cannot exceed the range size.
+    return std::min(range_size, elements.size() * range_size / hashed);
 }
 
 ColumnPtr ColumnString::replicate(const Offsets & replicate_offsets) const
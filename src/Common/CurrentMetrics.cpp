@@ -323,6 +323,8 @@
     M(DNSAddressesCacheSize, "Number of cached DNS addresses") \
     M(MarkCacheBytes, "Total size of mark cache in bytes") \
     M(MarkCacheFiles, "Total number of mark files cached in the mark cache") \
+    M(MarkCacheCompressedBytes, "Total size of the compressed tier of the mark cache in bytes") \
+    M(MarkCacheCompressedFiles, "Total number of mark files held in the compressed tier of the mark cache") \
     M(PrimaryIndexCacheBytes, "Total size of primary index cache in bytes") \
     M(PrimaryIndexCacheFiles, "Total number of index files cached in the primary index cache") \
     M(PageCacheBytes, "Total size of userspace page cache in bytes") \
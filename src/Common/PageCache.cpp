@@ -35,11 +35,18 @@ template class CacheBase<UInt128, PageCacheCell, UInt128TrivialHash, PageCacheWe
 
 UInt128 PageCacheKey::hash() const
 {
+    if (!path_and_version_hash)
+    {
+        SipHash path_hash;
+        path_hash.update(path.data(), path.size());
+        path_hash.update("\0", 1);
+        path_hash.update(file_version.data(), file_version.size());
+        path_and_version_hash = path_hash.get128();
+    }
+
     SipHash hash(offset);
     hash.update(size);
-    hash.update(path.data(), path.size());
-    hash.update("\0", 1);
-    hash.update(file_version.data(), file_version.size());
+    hash.update(*path_and_version_hash);
     return hash.get128();
 }
 
@@ -145,7 +152,7 @@ bool PageCache::contains(const PageCacheKey & key, bool inject_eviction) const
     return shard.contains(key_hash);
 }
 
-void PageCache::Shard::onEntryRemoval(const size_t weight_loss, const MappedPtr & mapped_ptr)
+void PageCache::Shard::onEntryRemoval(const Key & /*key*/, const size_t weight_loss, const MappedPtr & mapped_ptr)
 {
     ProfileEvents::increment(ProfileEvents::PageCacheWeightLost, weight_loss);
     UNUSED(mapped_ptr);
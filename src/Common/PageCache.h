@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include <Common/CacheBase.h>
 #include <Common/HashTable/Hash.h>
 #include <Common/thread_local_rng.h>
@@ -44,6 +46,12 @@ struct PageCacheKey
 
     UInt128 hash() const;
     std::string toString() const;
+
+    /// Cached digest of path and file_version, maintained by hash(). The path and the version
+    /// can be long (e.g. object storage keys), and readers rehash the same key with a different
+    /// offset for every block; hash them only once. Public only to keep the struct an aggregate
+    /// (keys are built with designated initializers); not part of the key's identity.
+    mutable std::optional<UInt128> path_and_version_hash;
 };
 
 class PageCacheCell
@@ -98,7 +106,7 @@ private:
     public:
         using Base::Base;
 
-        void onEntryRemoval(size_t weight_loss, const MappedPtr & mapped_ptr) override;
+        void onEntryRemoval(const Key & key, size_t weight_loss, const MappedPtr & mapped_ptr) override;
     };
 
 public:
@@ -285,6 +285,8 @@
     M(MarkCacheEvictedBytes, "Number of bytes evicted from the mark cache.", ValueType::Bytes) \
     M(MarkCacheEvictedMarks, "Number of marks evicted from the mark cache.", ValueType::Number) \
     M(MarkCacheEvictedFiles, "Number of mark files evicted from the mark cache.", ValueType::Number) \
+    M(MarkCacheCompressedTierHits, "Number of times evicted marks were promoted back from the compressed tier of the mark cache instead of being re-read from disk.", ValueType::Number) \
+    M(AggregationSingleLevelBlocksConvertedToTwoLevel, "Number of single-level aggregation blocks split into two-level buckets by the single grouping transform of a memory-efficient aggregation merge (used both by distributed initiators and by local memory-efficient merges). High values indicate serial CPU spent on re-bucketing.", ValueType::Number) \
     M(LoadedPrimaryIndexFiles, "Number of primary index files loaded.", ValueType::Number) \
     M(LoadedPrimaryIndexRows, "Number of rows of primary key loaded.", ValueType::Number) \
     M(LoadedPrimaryIndexBytes, "Number of rows of primary key loaded.", ValueType::Bytes) \
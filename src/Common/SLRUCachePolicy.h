@@ -329,7 +329,7 @@ private:
 
                 /// We cannot have protected cells in non-protected queue
                 chassert(!is_protected);
-                on_remove_entry_function(cell.size, cell.value);
+                on_remove_entry_function(key, cell.size, cell.value);
 
                 cells.erase(it);
                 queue.pop_front();
@@ -507,8 +507,12 @@ private:
     /// last index of offsets that was not processed
     size_t last;
 
-    /// limit for adding to hashtable. In worst case with case insensitive search, the table will be filled at most as half
-    static constexpr size_t small_limit = VolnitskyTraits::hash_size / 8;
+    /// Limit for adding to hashtable. Case insensitive search inserts up to four variants per
+    /// bigram, so its limit keeps the table at most half full. Case sensitive search inserts one
+    /// entry per bigram and can afford twice the budget at the same fill factor, which halves the
+    /// number of haystack passes for large pattern sets (the table is rebuilt and the haystack is
+    /// re-scanned for every batch of needles that fits).
+    static constexpr size_t small_limit = VolnitskyTraits::hash_size / (CaseSensitive ? 4 : 8);
 
 public:
     explicit MultiVolnitskyBase(const std::vector<std::string_view> & needles_) : needles{needles_}, step{0}, last{0}
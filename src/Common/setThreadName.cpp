@@ -39,6 +39,11 @@ void setThreadName(const char * name, bool truncate)
     memcpy(name_capped, name, name_capped_len);
     name_capped[name_capped_len] = '\0';
 
+    /// Connection handlers set the same name for every request of a keep-alive connection;
+    /// skip the syscall when the name does not change.
+    if (0 == strcmp(thread_name, name_capped))
+        return;
+
 #if defined(OS_FREEBSD)
     pthread_set_name_np(pthread_self(), name_capped);
     if ((false))
@@ -2,6 +2,7 @@
 #include <Compression/CompressionInfo.h>
 #include <Compression/CompressionFactory.h>
 #include <zstd.h>
+#include <boost/noncopyable.hpp>
 #include <Parsers/IAST.h>
 #include <Parsers/ASTLiteral.h>
 #include <Parsers/ASTFunction.h>
@@ -38,9 +39,32 @@ UInt32 CompressionCodecZSTD::getMaxCompressedDataSize(UInt32 uncompressed_size)
 }
 
 
-UInt32 CompressionCodecZSTD::doCompressData(const char * source, UInt32 source_size, char * dest) const
+namespace
+{
+
+/// Creating a (de)compression context costs several allocations and is comparable to the work of
+/// (de)compressing one small block, so reuse one context per thread. The session and parameters
+/// are reset on every use, so no state leaks between blocks or codecs with different settings.
+struct ZSTDCompressionContext : boost::noncopyable
 {
     ZSTD_CCtx * cctx = ZSTD_createCCtx();
+    ~ZSTDCompressionContext() { ZSTD_freeCCtx(cctx); }
+};
+
+struct ZSTDDecompressionContext : boost::noncopyable
+{
+    ZSTD_DCtx * dctx = ZSTD_createDCtx();
+    ~ZSTDDecompressionContext() { ZSTD_freeDCtx(dctx); }
+};
+
+}
+
+UInt32 CompressionCodecZSTD::doCompressData(const char * source, UInt32 source_size, char * dest) const
+{
+    static thread_local ZSTDCompressionContext context;
+    ZSTD_CCtx * cctx = context.cctx;
+
+    ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters);
     ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level);
     if (enable_long_range)
     {
@@ -48,7 +72,6 @@ UInt32 CompressionCodecZSTD::doCompressData(const char * source, UInt32 source_s
         ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, window_log); // NB zero window_log means "use default" for libzstd
     }
     size_t compressed_size = ZSTD_compress2(cctx, dest, ZSTD_compressBound(source_size), source, source_size);
-    ZSTD_freeCCtx(cctx);
 
     if (ZSTD_isError(compressed_size))
         throw Exception(ErrorCodes::CANNOT_COMPRESS, "Cannot compress with ZSTD codec: {}", ZSTD_getErrorName(compressed_size));
@@ -59,7 +82,10 @@ UInt32 CompressionCodecZSTD::doCompressData(const char * source, UInt32 source_s
 
 void CompressionCodecZSTD::doDecompressData(const char * source, UInt32 source_size, char * dest, UInt32 uncompressed_size) const
 {
-    size_t res = ZSTD_decompress(dest, uncompressed_size, source, source_size);
+    static thread_local ZSTDDecompressionContext context;
+
+    ZSTD_DCtx_reset(context.dctx, ZSTD_reset_session_and_parameters);
+    size_t res = ZSTD_decompressDCtx(context.dctx, dest, uncompressed_size, source, source_size);
 
     if (ZSTD_isError(res))
         throw Exception(ErrorCodes::CANNOT_DECOMPRESS, "Cannot decompress ZSTD-encoded data: {}", std::string(ZSTD_getErrorName(res)));
@@ -21,6 +21,7 @@
 #include <Common/Exception.h>
 #include <Common/SipHash.h>
 #include <Common/filesystemHelpers.h>
+#include <Common/Stopwatch.h>
 #include <Common/logger_useful.h>
 #include <Common/ThreadPool.h>
 #include <Common/ProfileEvents.h>
@@ -2119,14 +2120,18 @@ void Changelog::writeThread()
     bool batch_append_ok = true;
     size_t pending_appends = 0;
     bool try_batch_flush = false;
+    /// Exponential moving average of the flush (fsync) duration, used for adaptive group commit.
+    uint64_t flush_duration_ewma_us = 0;
 
     const auto flush_logs = [&](const auto & flush)
     {
         LOG_TEST(log, "Flushing {} logs", pending_appends);
 
         {
+            Stopwatch watch;
             std::lock_guard writer_lock(writer_mutex);
             current_writer->flush();
+            flush_duration_ewma_us = (flush_duration_ewma_us * 7 + watch.elapsedMicroseconds()) / 8;
         }
 
         {
@@ -2163,7 +2168,20 @@ void Changelog::writeThread()
                 /// but we try to get new append operations
                 /// if there are none, we apply the currently set Flush
                 chassert(std::holds_alternative<Flush>(write_operation));
-                if (!write_operations.tryPop(write_operation))
+
+                /// Group commit: a flush costs a full fsync regardless of the batch size, so it is
+                /// worth delaying it by a fraction of that cost to let concurrent appends join the
+                /// batch. The wait is bounded, so latency grows by at most ~25% in the worst case
+                /// while the number of entries per fsync can grow many times under write storms.
+                const uint64_t batch_wait_ms = flush_settings.adaptive_flush_wait
+                    ? std::min<uint64_t>(flush_duration_ewma_us / 4 / 1000, 10)
+                    : 0;
+
+                bool popped = batch_wait_ms
+                    ? write_operations.tryPop(write_operation, batch_wait_ms)
+                    : write_operations.tryPop(write_operation);
+
+                if (!popped)
                 {
                     chassert(batch_append_ok);
                     const auto & flush = std::get<Flush>(write_operation);
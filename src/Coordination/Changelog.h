@@ -128,6 +128,9 @@ struct LogFileSettings
 struct FlushSettings
 {
     uint64_t max_flush_batch_size = 1000;
+    /// Wait for more appends before fsyncing, up to a fraction of the observed fsync latency
+    /// (group commit). Increases the batch size under load at a bounded latency cost.
+    bool adaptive_flush_wait = false;
 };
 
 struct LogLocation
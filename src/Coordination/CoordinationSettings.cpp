@@ -46,8 +46,9 @@ namespace ErrorCodes
     DECLARE(UInt64, max_requests_batch_bytes_size, 100*1024, "Max size in bytes of batch of requests that can be sent to RAFT", 0) \
     DECLARE(UInt64, max_requests_append_size, 100, "Max size of batch of requests that can be sent to replica in append request", 0) \
     DECLARE(UInt64, max_flush_batch_size, 1000, "Max size of batch of requests that can be flushed together", 0) \
+    DECLARE(Bool, adaptive_flush_wait, false, "Before fsyncing the Raft log, wait for more appends for up to a fraction of the observed fsync latency (adaptive group commit)", 0) \
     DECLARE(UInt64, max_requests_quick_batch_size, 100, "Max size of batch of requests to try to get before proceeding with RAFT. Keeper will not wait for requests but take only requests that are already in queue" , 0) \
-    DECLARE(Bool, quorum_reads, false, "Execute read requests as writes through whole RAFT consesus with similar speed", 0) \
+    DECLARE(Bool, quorum_reads, false, "Execute read requests as writes through whole RAFT consesus with similar speed. Note: with the default false, reads are already served locally by the replica that received them after a lightweight commit-index sync, so followers shoulder read traffic; leader-lease-based local reads without that sync would additionally need clock-bound leases in the Raft layer.", 0) \
     DECLARE(Bool, force_sync, true, "Call fsync on each change in RAFT changelog", 0) \
     DECLARE(Bool, compress_logs, false, "Write compressed coordination logs in ZSTD format", 0) \
     DECLARE(Bool, compress_snapshots_with_zstd_format, true, "Write compressed snapshots in ZSTD format (instead of custom LZ4)", 0) \
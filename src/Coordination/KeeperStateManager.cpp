@@ -26,6 +26,7 @@ namespace CoordinationSetting
     extern const CoordinationSettingsUInt64 latest_logs_cache_size_threshold;
     extern const CoordinationSettingsUInt64 log_file_overallocate_size;
     extern const CoordinationSettingsUInt64 max_flush_batch_size;
+    extern const CoordinationSettingsBool adaptive_flush_wait;
     extern const CoordinationSettingsUInt64 max_log_file_size;
     extern const CoordinationSettingsUInt64 rotate_log_storage_interval;
 }
@@ -315,6 +316,7 @@ KeeperStateManager::KeeperStateManager(
           FlushSettings
           {
               .max_flush_batch_size = keeper_context_->getCoordinationSettings()[CoordinationSetting::max_flush_batch_size],
+              .adaptive_flush_wait = keeper_context_->getCoordinationSettings()[CoordinationSetting::adaptive_flush_wait],
           },
           keeper_context_))
     , server_state_file_name(server_state_file_name_)
@@ -198,6 +198,9 @@ When reading ORC files, skip whole stripes or row groups based on the WHERE/PREW
 )", 0) \
     DECLARE(String, input_format_orc_reader_time_zone_name, "GMT", R"(
 The time zone name for ORC row reader, the default ORC row reader's time zone is GMT.
+)", 0) \
+    DECLARE(Bool, input_format_parquet_dictionary_as_low_cardinality, false, R"(
+Keep dictionary-encoded Parquet columns dictionary-encoded while reading, producing LowCardinality columns instead of decoding to plain columns and re-encoding later.
 )", 0) \
     DECLARE(Bool, input_format_orc_dictionary_as_low_cardinality, true, R"(
 Treat ORC dictionary encoded columns as LowCardinality columns while reading ORC files.
@@ -994,6 +997,9 @@ Use a faster Parquet encoder implementation.
 )", 0) \
     DECLARE(Bool, output_format_parquet_parallel_encoding, true, R"(
 Do Parquet encoding in multiple threads. Requires output_format_parquet_use_custom_encoder.
+)", 0) \
+    DECLARE(UInt64, output_format_parquet_encoding_threads, 0, R"(
+Number of threads used for parallel Parquet encoding. 0 - use max_threads. Allows to cap the encoder thread budget of exports independently of the query thread count.
 )", 0) \
     DECLARE(UInt64, output_format_parquet_data_page_size, 1024 * 1024, R"(
 Target page size in bytes, before compression.
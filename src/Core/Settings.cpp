@@ -964,6 +964,18 @@ From what number of keys, a two-level aggregation starts. 0 - the threshold is n
 )", 0) \
     DECLARE(UInt64, group_by_two_level_threshold_bytes, 50000000, R"(
 From what size of the aggregation state in bytes, a two-level aggregation begins to be used. 0 - the threshold is not set. Two-level aggregation is used when at least one of the thresholds is triggered.
+)", 0) \
+    DECLARE(Bool, enable_external_distinct, false, R"(
+Spill DISTINCT keys that do not fit into the memory limits (max_rows_in_distinct / max_bytes_in_distinct) to disk partitions and deduplicate them partition by partition, instead of throwing an exception.
+Peak memory usage is bounded by the limit plus the set of one partition.
+)", 0) \
+    DECLARE(Bool, group_by_adaptive_two_level_conversion, false, R"(
+Convert aggregation hash tables to the two-level layout before `group_by_two_level_threshold` is reached when the cardinality observed in the first processed rows predicts that the threshold will be crossed anyway.
+Early conversion happens while the table is still small, which removes the mid-query rehash latency spike on high-cardinality GROUP BYs. Low-cardinality queries are unaffected.
+)", 0) \
+    DECLARE(Bool, group_by_numa_partitioning, false, R"(
+Assign contiguous ranges of two-level aggregation buckets to merging threads instead of distributing buckets dynamically.
+Each thread then works on a compact region of the hash space, which keeps its working set local to one CPU cache / NUMA node on large multi-socket machines, at the cost of less dynamic load balancing.
 )", 0) \
     DECLARE(Bool, distributed_aggregation_memory_efficient, true, R"(
 Is the memory-saving mode of distributed aggregation enabled.
@@ -1326,6 +1338,12 @@ If the distance between two data blocks to be read in one file is less than `mer
 Possible values:
 
 - Any positive integer.
+)", 0) \
+    DECLARE(UInt64, merge_tree_min_rows_for_seek_for_remote_filesystem, 0, R"(
+The same as `merge_tree_min_rows_for_seek`, but used for parts located on remote filesystems, where every separate range becomes a separate object storage request.
+)", 0) \
+    DECLARE(UInt64, merge_tree_min_bytes_for_seek_for_remote_filesystem, 4 * 1024 * 1024, R"(
+The same as `merge_tree_min_bytes_for_seek`, but used for parts located on remote filesystems. Gaps up to this size are read through and discarded instead of being split into separate object storage requests, which reduces the request count and cold-read latency.
 )", 0) \
     DECLARE(UInt64, merge_tree_coarse_index_granularity, 8, R"(
 When searching for data, ClickHouse checks the data marks in the index file. If ClickHouse finds that required keys are in some range, it divides this range into `merge_tree_coarse_index_granularity` subranges and searches the required keys there recursively.
@@ -2559,6 +2577,11 @@ The recommended value is half of the available system memory.
 The ratio of available memory that is allowed for `GROUP BY`. Once reached,
 external memory is used for aggregation.
 
+Together with `max_bytes_ratio_before_external_sort` / `..._join` this forms a coarse per-query
+memory arbiter: thresholds are evaluated against the query's CURRENT memory usage, so a sort and
+a join in one query observe each other's consumption and spill earlier when sharing the budget,
+unlike the absolute `max_bytes_before_external_*` settings, which assume sole ownership.
+
 For example, if set to `0.6`, `GROUP BY` will allow using 60% of the available memory
 (to server/user/merges) at the beginning of the execution, after that, it will
 start using external aggregation.
@@ -5586,6 +5609,9 @@ Min bytes required for remote read (url, s3) to do seek, instead of read with ig
     DECLARE_WITH_ALIAS(UInt64, merge_tree_min_bytes_per_task_for_remote_reading, 2 * DBMS_DEFAULT_BUFFER_SIZE, R"(
 Min bytes to read per task.
 )", 0, filesystem_prefetch_min_bytes_for_single_read_task) \
+    DECLARE(UInt64, merge_tree_min_bytes_per_task_for_local_reading, 0, R"(
+Min bytes to read per task for parts on local disks. Makes the task size follow the actual compressed size of the read columns, so tasks over parts with heavy columns or adaptive granularity carry comparable amounts of work. 0 - task size is determined by marks only.
+)", 0) \
     DECLARE(Bool, merge_tree_use_const_size_tasks_for_remote_reading, true, R"(
 Whether to use constant size tasks for reading from a remote table.
 )", 0) \
@@ -75,6 +75,12 @@ const VersionToSettingsChangesMap & getSettingsChangesHistory()
             {"cluster_function_process_archive_on_multiple_nodes", true, true, "New setting"},
             {"distributed_plan_max_rows_to_broadcast", 20000, 20000, "New experimental setting."},
             {"min_joined_block_size_rows", 0, DEFAULT_BLOCK_SIZE, "New setting."},
+            {"group_by_numa_partitioning", false, false, "New setting to improve aggregation merge locality on multi-socket machines."},
+            {"group_by_adaptive_two_level_conversion", false, false, "New setting to convert aggregation hash tables to two-level early based on observed cardinality."},
+            {"enable_external_distinct", false, false, "New setting to allow DISTINCT to spill to disk when memory limits are exceeded."},
+            {"merge_tree_min_bytes_per_task_for_local_reading", 0, 0, "New setting to size read tasks of local parts by compressed bytes."},
+            {"merge_tree_min_rows_for_seek_for_remote_filesystem", 0, 0, "New setting with a separate seek-merging threshold for parts on remote filesystems."},
+            {"merge_tree_min_bytes_for_seek_for_remote_filesystem", 0, 4 * 1024 * 1024, "Merge nearby read ranges of parts on remote filesystems to reduce the number of object storage requests."},
         });
         addSettingsChanges(settings_changes_history, "25.6",
         {
@@ -291,6 +291,8 @@ struct FormatSettings
         bool preserve_order = false;
         bool use_custom_encoder = true;
         bool parallel_encoding = true;
+        bool dictionary_as_low_cardinality = false;
+        size_t encoding_threads = 0; /// 0 - use max_threads
         bool output_compliant_nested_types = true;
         bool write_page_index = false;
         bool write_bloom_filter = false;
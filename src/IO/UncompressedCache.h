@@ -62,7 +62,7 @@ public:
 
 private:
     /// Called for each individual entry being evicted from cache
-    void onEntryRemoval(const size_t weight_loss, const MappedPtr & mapped_ptr) override
+    void onEntryRemoval(const Key & /*key*/, const size_t weight_loss, const MappedPtr & mapped_ptr) override
     {
         ProfileEvents::increment(ProfileEvents::UncompressedCacheWeightLost, weight_loss);
         UNUSED(mapped_ptr);
@@ -55,6 +55,11 @@ struct AggregatedDataVariants : private boost::noncopyable
     /// Stats can be used to disable the cache in case of a lot of misses.
     ColumnsHashing::LastElementCacheStats consecutive_keys_cache_stats;
 
+    /// Number of source rows aggregated into this set so far.
+    /// Together with size() it gives the observed distinct-key ratio, which is used
+    /// to decide on an early conversion to the two-level layout (see group_by_adaptive_two_level_conversion).
+    size_t aggregated_input_rows = 0;
+
     // Disable consecutive key optimization for Uint8/16, because they use a FixedHashMap
     // and the lookup there is almost free, so we don't need to cache the last lookup result
     std::unique_ptr<AggregationMethodOneNumber<UInt8, AggregatedDataWithUInt8Key, false>>           key8;
@@ -1722,9 +1722,23 @@ bool Aggregator::executeOnBlock(Columns columns,
     /// Here all the results in the sum are taken into account, from different threads.
     auto result_size_bytes = current_memory_usage - memory_usage_before_aggregation;
 
+    result.aggregated_input_rows += row_end - row_begin;
+
     bool worth_convert_to_two_level = worthConvertToTwoLevel(
         params.group_by_two_level_threshold, result_size, params.group_by_two_level_threshold_bytes, result_size_bytes);
 
+    /** If almost every row we have seen so far produced a new key, the table will most likely keep
+      * growing up to the two-level threshold, and converting it now is strictly cheaper than converting
+      * it later when it is several times bigger. This removes the mid-query rehash latency spike for
+      * high-cardinality GROUP BYs without affecting low-cardinality ones, where the ratio drops quickly.
+      */
+    static constexpr size_t adaptive_conversion_min_rows = 16384;
+    if (!worth_convert_to_two_level && params.group_by_adaptive_two_level_conversion && params.group_by_two_level_threshold
+        && result.aggregated_input_rows >= adaptive_conversion_min_rows
+        && result_size * 10 >= result.aggregated_input_rows * 9
+        && result_size >= params.group_by_two_level_threshold / 8)
+        worth_convert_to_two_level = true;
+
     /** Converting to a two-level data structure.
       * It allows you to make, in the subsequent, an effective merge - either economical from memory or parallel.
       */
@@ -114,6 +114,12 @@ public:
         bool only_merge = false;
         bool enable_prefetch = false;
         bool optimize_group_by_constant_keys = false;
+        /// Merge contiguous ranges of two-level buckets per thread to keep the working set of each
+        /// merging thread local to one CPU cache / NUMA node (see group_by_numa_partitioning).
+        bool group_by_numa_partitioning = false;
+        /// Convert to the two-level layout before group_by_two_level_threshold is reached
+        /// when the observed cardinality growth predicts that the threshold will be crossed anyway.
+        bool group_by_adaptive_two_level_conversion = false;
         const float min_hit_rate_to_use_consecutive_keys_optimization = 0.;
         StatsCollectingParams stats_collecting_params;
 
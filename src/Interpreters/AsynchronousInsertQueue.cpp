@@ -115,32 +115,42 @@ AsynchronousInsertQueue::InsertQuery::InsertQuery(
     , current_roles(current_roles_)
     , settings(std::make_unique<Settings>(settings_))
     , data_kind(data_kind_)
+{
+    setting_changes = settings->changes();
+    std::erase_if(setting_changes, [](const auto & change) { return settings_to_skip.contains(change.name); });
+
+    hash = calculateHash(*query, user_id, current_roles, settings_, data_kind);
+}
+
+UInt128 AsynchronousInsertQueue::InsertQuery::calculateHash(
+    const IAST & query_,
+    const std::optional<UUID> & user_id_,
+    const std::vector<UUID> & current_roles_,
+    const Settings & settings_,
+    AsynchronousInsertQueueDataKind data_kind_)
 {
     SipHash siphash;
 
-    siphash.update(data_kind);
-    query->updateTreeHash(siphash, /*ignore_aliases=*/ true);
+    siphash.update(data_kind_);
+    query_.updateTreeHash(siphash, /*ignore_aliases=*/ true);
 
-    if (user_id)
+    if (user_id_)
     {
-        siphash.update(*user_id);
-        for (const auto & current_role : current_roles)
+        siphash.update(*user_id_);
+        for (const auto & current_role : current_roles_)
             siphash.update(current_role);
     }
 
-    setting_changes = settings->changes();
-    for (auto it = setting_changes.begin(); it != setting_changes.end(); ++it)
+    for (const auto & change : settings_.changes())
     {
-        if (settings_to_skip.contains(it->name))
-            it = setting_changes.erase(it);
-        else
-        {
-            siphash.update(it->name);
-            applyVisitor(FieldVisitorHash(siphash), it->value);
-        }
+        if (settings_to_skip.contains(change.name))
+            continue;
+
+        siphash.update(change.name);
+        applyVisitor(FieldVisitorHash(siphash), change.value);
     }
 
-    hash = siphash.get128();
+    return siphash.get128();
 }
 
 AsynchronousInsertQueue::InsertQuery::InsertQuery(const InsertQuery & other)
@@ -465,17 +475,28 @@ AsynchronousInsertQueue::PushResult AsynchronousInsertQueue::pushDataChunk(ASTPt
     if (insert_query.format == "Values")
         entry->query_parameters = query_context->getQueryParameters();
 
-    InsertQuery key{query, query_context->getUserID(), query_context->getCurrentRoles(), settings, data_kind};
+    /// Constructing the full key clones the query, formats it and copies the settings.
+    /// In the steady state an entry for this query shape already exists in the queue,
+    /// so compute only the hash upfront and build the key lazily when it is needed.
+    const auto key_hash = InsertQuery::calculateHash(*query, query_context->getUserID(), query_context->getCurrentRoles(), settings, data_kind);
+    std::optional<InsertQuery> key;
+    const auto make_key = [&]() -> InsertQuery &
+    {
+        if (!key)
+            key.emplace(InsertQuery{query, query_context->getUserID(), query_context->getCurrentRoles(), settings, data_kind});
+        return *key;
+    };
+
     InsertDataPtr data_to_process;
     std::future<void> insert_future;
 
-    auto shard_num = key.hash % pool_size;
+    auto shard_num = key_hash % pool_size;
     auto & shard = queue_shards[shard_num];
     const auto flush_time_points = flush_time_history_per_queue_shard[shard_num].getRecentTimePoints();
     {
         std::lock_guard lock(shard.mutex);
 
-        auto [it, inserted] = shard.iterators.try_emplace(key.hash);
+        auto [it, inserted] = shard.iterators.try_emplace(key_hash);
         auto now = std::chrono::steady_clock::now();
         auto timeout_ms = getBusyWaitTimeoutMs(settings, shard, flush_time_points, now);
         if (timeout_ms != shard.busy_timeout_ms)
@@ -490,7 +511,7 @@ AsynchronousInsertQueue::PushResult AsynchronousInsertQueue::pushDataChunk(ASTPt
         }
 
         if (inserted)
-            it->second = shard.queue.emplace(now + timeout_ms, Container{key, std::make_unique<InsertData>(timeout_ms)}).first;
+            it->second = shard.queue.emplace(now + timeout_ms, Container{make_key(), std::make_unique<InsertData>(timeout_ms)}).first;
 
         auto queue_it = it->second;
         auto & data = queue_it->second.data;
@@ -504,11 +525,12 @@ AsynchronousInsertQueue::PushResult AsynchronousInsertQueue::pushDataChunk(ASTPt
         insert_future = entry->getFuture();
 
         LOG_TRACE(log, "Have {} pending inserts with total {} bytes of data for query '{}'",
-            data->entries.size(), data->size_in_bytes, key.query_str);
+            data->entries.size(), data->size_in_bytes, queue_it->second.key.query_str);
 
-        bool has_enough_bytes = data->size_in_bytes >= (*key.settings)[Setting::async_insert_max_data_size];
+        /// The settings of the queries grouped under one key are the same (they are part of the key).
+        bool has_enough_bytes = data->size_in_bytes >= settings[Setting::async_insert_max_data_size];
         bool has_enough_queries
-            = data->entries.size() >= (*key.settings)[Setting::async_insert_max_query_number] && (*key.settings)[Setting::async_insert_deduplicate];
+            = data->entries.size() >= settings[Setting::async_insert_max_query_number] && settings[Setting::async_insert_deduplicate];
 
         auto max_busy_timeout_exceeded = [&shard, &settings, &now, &flush_time_points]() -> bool
         {
@@ -527,6 +549,9 @@ AsynchronousInsertQueue::PushResult AsynchronousInsertQueue::pushDataChunk(ASTPt
         {
             data->timeout_ms = Milliseconds::zero();
             data_to_process = std::move(data);
+            /// The container being removed already holds a fully constructed key, reuse it.
+            if (!key)
+                key.emplace(std::move(queue_it->second.key));
             shard.iterators.erase(it);
             shard.queue.erase(queue_it);
         }
@@ -553,7 +578,7 @@ AsynchronousInsertQueue::PushResult AsynchronousInsertQueue::pushDataChunk(ASTPt
     }
 
     if (data_to_process)
-        scheduleDataProcessingJob(key, std::move(data_to_process), getContext(), shard_num);
+        scheduleDataProcessingJob(make_key(), std::move(data_to_process), getContext(), shard_num);
     else
         shard.are_tasks_available.notify_one();
 
@@ -83,6 +83,16 @@ private:
             const Settings & settings_,
             AsynchronousInsertQueueDataKind data_kind_);
 
+        /// The same hash as the constructor computes, but without cloning the query,
+        /// formatting it and copying the settings. Used to look up an existing queue
+        /// entry before paying for the full key construction.
+        static UInt128 calculateHash(
+            const IAST & query_,
+            const std::optional<UUID> & user_id_,
+            const std::vector<UUID> & current_roles_,
+            const Settings & settings_,
+            AsynchronousInsertQueueDataKind data_kind_);
+
         InsertQuery(const InsertQuery & other);
         InsertQuery & operator=(const InsertQuery & other);
         bool operator==(const InsertQuery & other) const;
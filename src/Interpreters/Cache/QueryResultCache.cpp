@@ -9,6 +9,7 @@
 #include <Parsers/ASTFunction.h>
 #include <Parsers/ASTIdentifier.h>
 #include <Parsers/ASTLiteral.h>
+#include <Parsers/ASTSelectQuery.h>
 #include <Parsers/ASTSetQuery.h>
 #include <Parsers/IAST.h>
 #include <Parsers/IParser.h>
@@ -208,12 +209,20 @@ public:
 
             std::erase_if(set_clause->changes, is_query_cache_related_setting);
         }
+        else if (auto * select = ast->as<ASTSelectQuery>())
+        {
+            /// Drop a SETTINGS clause that holds only query-result-cache related settings, so that
+            /// e.g. `SELECT 1 SETTINGS use_query_cache = true` and `SELECT 1` share a cache entry.
+            /// This visitor runs top to bottom, so erase the settings here before deciding.
+            if (auto settings_ast = select->settings())
+            {
+                auto & changes = settings_ast->as<ASTSetQuery &>().changes;
+                std::erase_if(changes, [](const auto & change) { return isQueryResultCacheRelatedSetting(change.name); });
+                if (changes.empty())
+                    select->setExpression(ASTSelectQuery::Expression::SETTINGS, {});
+            }
+        }
     }
-
-    /// TODO further improve AST cleanup, e.g. remove SETTINGS clause completely if it is empty
-    /// E.g. SELECT 1 SETTINGS use_query_cache = true
-    /// and  SELECT 1;
-    /// currently don't match.
 };
 
 using RemoveQueryResultCacheSettingsVisitor = InDepthNodeVisitor<RemoveQueryResultCacheSettingsMatcher, true>;
@@ -21,8 +21,11 @@
 #include <Common/BitHelpers.h>
 #include <Common/CurrentThread.h>
 #include <Common/Exception.h>
+#include <Common/getThreadId.h>
 #include <Common/ProfileEvents.h>
 #include <Common/ThreadPool.h>
+
+#include <thread>
 #include <Common/WeakHash.h>
 #include <Common/scope_guard_safe.h>
 #include <Common/setThreadName.h>
@@ -262,11 +265,20 @@ bool ConcurrentHashJoin::addBlockToJoin(const Block & right_block_, bool check_l
         }
     }
 
+    /// Start from a thread-specific shard. If every thread scanned the shards from the beginning,
+    /// they would all compete for the same locks in the same order, and with dozens of build threads
+    /// most of them would spin on try_lock instead of inserting.
+    const size_t num_shards = dispatched_blocks.size();
+    const size_t shard_offset = getThreadId() % num_shards;
+
     while (blocks_left > 0)
     {
+        bool made_progress = false;
+
         /// insert blocks into corresponding HashJoin instances
-        for (size_t i = 0; i < dispatched_blocks.size(); ++i)
+        for (size_t idx = 0; idx < num_shards; ++idx)
         {
+            const size_t i = (idx + shard_offset) % num_shards;
             auto & hash_join = hash_joins[i];
             auto & dispatched_block = dispatched_blocks[i];
 
@@ -287,11 +299,17 @@ bool ConcurrentHashJoin::addBlockToJoin(const Block & right_block_, bool check_l
 
                 dispatched_block = {};
                 blocks_left--;
+                made_progress = true;
 
                 if (limit_exceeded)
                     return false;
             }
         }
+
+        /// All remaining shards are owned by other threads right now. Let them finish
+        /// instead of burning the core on try_lock.
+        if (!made_progress && blocks_left > 0)
+            std::this_thread::yield();
     }
 
     if (check_limits && table_join->sizeLimits().hasLimits())
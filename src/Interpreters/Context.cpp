@@ -303,6 +303,7 @@ namespace ServerSetting
     extern const ServerSettingsUInt64 max_local_read_bandwidth_for_server;
     extern const ServerSettingsUInt64 max_local_write_bandwidth_for_server;
     extern const ServerSettingsUInt64 max_merges_bandwidth_for_server;
+    extern const ServerSettingsUInt64 max_merges_bandwidth_for_server_when_queries_running;
     extern const ServerSettingsUInt64 max_mutations_bandwidth_for_server;
     extern const ServerSettingsUInt64 max_remote_read_network_bandwidth_for_server;
     extern const ServerSettingsUInt64 max_remote_write_network_bandwidth_for_server;
@@ -520,6 +521,8 @@ struct ContextSharedPart : boost::noncopyable
 
     mutable ThrottlerPtr mutations_throttler;               /// A server-wide throttler for mutations
     mutable ThrottlerPtr merges_throttler;                  /// A server-wide throttler for merges
+    size_t merges_bandwidth = 0;                            /// Configured speeds for the merges throttler:
+    size_t merges_bandwidth_when_queries_running = 0;       /// when the server is idle and under query load
 
     MultiVersion<Macros> macros;                            /// Substitutions extracted from config.
     std::unique_ptr<DDLWorker> ddl_worker TSA_GUARDED_BY(mutex); /// Process ddl commands from zk.
@@ -1010,8 +1013,10 @@ struct ContextSharedPart : boost::noncopyable
         if (auto bandwidth = server_settings[ServerSetting::max_mutations_bandwidth_for_server])
             mutations_throttler = std::make_shared<Throttler>(bandwidth);
 
-        if (auto bandwidth = server_settings[ServerSetting::max_merges_bandwidth_for_server])
-            merges_throttler = std::make_shared<Throttler>(bandwidth);
+        merges_bandwidth = server_settings[ServerSetting::max_merges_bandwidth_for_server];
+        merges_bandwidth_when_queries_running = server_settings[ServerSetting::max_merges_bandwidth_for_server_when_queries_running];
+        if (merges_bandwidth || merges_bandwidth_when_queries_running)
+            merges_throttler = std::make_shared<Throttler>(merges_bandwidth);
     }
 };
 
@@ -3431,14 +3436,14 @@ void Context::clearPageCache() const
         cache->clear();
 }
 
-void Context::setMarkCache(const String & cache_policy, size_t max_cache_size_in_bytes, double size_ratio)
+void Context::setMarkCache(const String & cache_policy, size_t max_cache_size_in_bytes, size_t max_compressed_cache_size_in_bytes, double size_ratio)
 {
     std::lock_guard lock(shared->mutex);
 
     if (shared->mark_cache)
         throw Exception(ErrorCodes::LOGICAL_ERROR, "Mark cache has been already created.");
 
-    shared->mark_cache = std::make_shared<MarkCache>(cache_policy, max_cache_size_in_bytes, size_ratio);
+    shared->mark_cache = std::make_shared<MarkCache>(cache_policy, max_cache_size_in_bytes, max_compressed_cache_size_in_bytes, size_ratio);
 }
 
 void Context::updateMarkCacheConfiguration(const Poco::Util::AbstractConfiguration & config)
@@ -3575,7 +3580,7 @@ void Context::setIndexMarkCache(const String & cache_policy, size_t max_cache_si
     if (shared->index_mark_cache)
         throw Exception(ErrorCodes::LOGICAL_ERROR, "Index mark cache has been already created.");
 
-    shared->index_mark_cache = std::make_shared<MarkCache>(cache_policy, max_cache_size_in_bytes, size_ratio);
+    shared->index_mark_cache = std::make_shared<MarkCache>(cache_policy, max_cache_size_in_bytes, /*max_compressed_size_in_bytes=*/ 0, size_ratio);
 }
 
 void Context::updateIndexMarkCacheConfiguration(const Poco::Util::AbstractConfiguration & config)
@@ -4062,6 +4067,20 @@ ThrottlerPtr Context::getMutationsThrottler() const
     return shared->mutations_throttler;
 }
 
+void Context::updateMergesThrottlerForQueryLoad(bool has_running_queries) const
+{
+    /// Let merges consume only the slack bandwidth while queries are running (see
+    /// max_merges_bandwidth_for_server_when_queries_running). No-op unless configured.
+    if (!shared->merges_throttler || !shared->merges_bandwidth_when_queries_running)
+        return;
+
+    auto * throttler = typeid_cast<Throttler *>(shared->merges_throttler.get());
+    if (!throttler)
+        return;
+
+    throttler->setMaxSpeed(has_running_queries ? shared->merges_bandwidth_when_queries_running : shared->merges_bandwidth);
+}
+
 ThrottlerPtr Context::getMergesThrottler() const
 {
     return shared->merges_throttler;
@@ -296,8 +296,31 @@ static FunctionBasePtr compile(
     {
         auto [compiled_function_cache_entry, _] = compilation_cache->getOrSet(hash_key, [&] ()
         {
+            auto & cache_factory = CompiledExpressionCacheFactory::instance();
+
+            if (auto object_code = cache_factory.tryReadPersistedObjectCode(hash_key))
+            {
+                try
+                {
+                    LOG_TRACE(getLogger(), "Load compiled expression {} from persistent cache", llvm_function->getName());
+                    auto compiled_function = loadCompiledFunction(getJITInstance(), *object_code, llvm_function->getName());
+                    return std::make_shared<CompiledFunctionHolder>(compiled_function);
+                }
+                catch (...)
+                {
+                    tryLogCurrentException(getLogger(), "Cannot load persisted compiled expression, will recompile");
+                }
+            }
+
             LOG_TRACE(getLogger(), "Compile expression {}", llvm_function->getName());
-            auto compiled_function = compileFunction(getJITInstance(), *llvm_function);
+
+            std::string object_code;
+            auto compiled_function = compileFunction(
+                getJITInstance(), *llvm_function, cache_factory.persistentStorageEnabled() ? &object_code : nullptr);
+
+            if (cache_factory.persistentStorageEnabled())
+                cache_factory.persistObjectCode(hash_key, object_code);
+
             return std::make_shared<CompiledFunctionHolder>(compiled_function);
         });
 
@@ -163,6 +163,14 @@ public:
         return AccumulatedBlockReader(right_file.getReadStream(), right_file_mutex);
     }
 
+    /// Read-only stream over the right file for read-ahead. Unlike startJoining() it does NOT
+    /// transition the bucket state: the bucket is not current yet, and probing of the current
+    /// bucket still scatters left rows into it, which requires WRITING_BLOCKS state.
+    AccumulatedBlockReader readRightForPrefetch()
+    {
+        return AccumulatedBlockReader(right_file.getReadStream(), right_file_mutex);
+    }
+
     AccumulatedBlockReader getLeftTableReader()
     {
         ensureState(State::JOINING_BLOCKS);
@@ -292,7 +300,11 @@ bool GraceHashJoin::isSupported(const std::shared_ptr<TableJoin> & table_join)
     return !is_asof && (isInner(kind) || isLeft(kind) || isRight(kind) || isFull(kind)) && table_join->oneDisjunct();
 }
 
-GraceHashJoin::~GraceHashJoin() = default;
+GraceHashJoin::~GraceHashJoin()
+{
+    if (prefetch_thread.joinable())
+        prefetch_thread.join();
+}
 
 bool GraceHashJoin::addBlockToJoin(const Block & block, bool /*check_limits*/)
 {
@@ -650,18 +662,59 @@ IBlocksStreamPtr GraceHashJoin::getDelayedBlocks()
         }
 
         hash_join = makeInMemoryJoin(fmt::format("grace{}", bucket_idx), prev_keys_num);
-        auto right_reader = current_bucket->startJoining();
         size_t num_rows = 0; /// count rows that were written and rehashed
-        while (Block block = right_reader.read())
+
+        if (auto blocks = takePrefetchedBlocks(bucket_idx))
+        {
+            /// The prefetch read the right file without transitioning the bucket state (left
+            /// rows could still be scattered into it); now that the bucket becomes current,
+            /// perform the transition. The returned reader is only consumed when the prefetch
+            /// stopped at its byte budget.
+            auto right_reader = current_bucket->startJoining();
+
+            for (auto & block : *blocks)
+            {
+                num_rows += block.rows();
+                addBlockToJoinImpl(std::move(block));
+            }
+
+            /// Read the rest of the bucket, skipping the block prefix
+            /// that was already consumed from the prefetched list.
+            if (prefetch_stopped_early)
+            {
+                prefetch_stopped_early = false;
+                size_t blocks_to_skip = blocks->size();
+                while (Block block = right_reader.read())
+                {
+                    if (blocks_to_skip)
+                    {
+                        --blocks_to_skip;
+                        continue;
+                    }
+                    num_rows += block.rows();
+                    addBlockToJoinImpl(std::move(block));
+                }
+            }
+        }
+        else
         {
-            num_rows += block.rows();
-            addBlockToJoinImpl(std::move(block));
+            auto right_reader = current_bucket->startJoining();
+            while (Block block = right_reader.read())
+            {
+                num_rows += block.rows();
+                addBlockToJoinImpl(std::move(block));
+            }
         }
         hash_join->onBuildPhaseFinish();
 
         LOG_TRACE(log, "Loaded bucket {} with {}(/{}) rows",
             bucket_idx, hash_join->getTotalRowCount(), num_rows);
 
+        /// Rows rehashed out of this bucket have been flushed to the later buckets by now,
+        /// so the right side of the next bucket is complete and can be read ahead
+        /// while this bucket is being probed.
+        prefetchNextBucket(bucket_idx);
+
         return std::make_unique<DelayedBlocks>(current_bucket->idx, buckets, hash_join, left_key_names, right_key_names);
     }
 
@@ -671,6 +724,75 @@ IBlocksStreamPtr GraceHashJoin::getDelayedBlocks()
     return nullptr;
 }
 
+void GraceHashJoin::prefetchNextBucket(size_t loaded_bucket_idx)
+{
+    if (prefetch_thread.joinable())
+        prefetch_thread.join();
+
+    prefetched_bucket_idx.reset();
+    prefetched_blocks.clear();
+    prefetch_stopped_early = false;
+    prefetch_exception = nullptr;
+
+    for (size_t next_idx = loaded_bucket_idx + 1; next_idx < buckets.size(); ++next_idx)
+    {
+        if (buckets[next_idx]->empty())
+            continue;
+
+        /// Grace hash join exists because memory is tight: prefetching the whole next bucket
+        /// while the current one is probed can double peak memory. Read ahead only up to a
+        /// fraction of the in-memory join budget and let the loader continue from the stream.
+        size_t max_prefetched_bytes = table_join->sizeLimits().max_bytes
+            ? table_join->sizeLimits().max_bytes / 4
+            : 128 * 1024 * 1024;
+
+        prefetched_bucket_idx = next_idx;
+        prefetch_thread = ThreadFromGlobalPool([this, bucket = buckets[next_idx].get(), max_prefetched_bytes]
+        {
+            try
+            {
+                auto reader = bucket->readRightForPrefetch();
+                size_t prefetched_bytes = 0;
+                while (Block block = reader.read())
+                {
+                    prefetched_bytes += block.allocatedBytes();
+                    prefetched_blocks.emplace_back(std::move(block));
+
+                    if (prefetched_bytes >= max_prefetched_bytes)
+                    {
+                        prefetch_stopped_early = true;
+                        break;
+                    }
+                }
+            }
+            catch (...)
+            {
+                prefetch_exception = std::current_exception();
+            }
+        });
+        return;
+    }
+}
+
+std::optional<Blocks> GraceHashJoin::takePrefetchedBlocks(size_t bucket_idx)
+{
+    if (prefetch_thread.joinable())
+        prefetch_thread.join();
+
+    if (prefetched_bucket_idx != bucket_idx)
+    {
+        prefetch_stopped_early = false;
+        return std::nullopt;
+    }
+
+    prefetched_bucket_idx.reset();
+
+    if (prefetch_exception)
+        std::rethrow_exception(std::exchange(prefetch_exception, nullptr));
+
+    return std::exchange(prefetched_blocks, {});
+}
+
 GraceHashJoin::InMemoryJoinPtr GraceHashJoin::makeInMemoryJoin(const String & bucket_id, size_t reserve_num)
 {
     return std::make_unique<HashJoin>(table_join, right_sample_block, any_take_last_row, reserve_num, bucket_id);
@@ -2,6 +2,7 @@
 
 #include <Interpreters/Context_fwd.h>
 #include <Interpreters/IJoin.h>
+#include <Common/ThreadPool.h>
 #include <Interpreters/TemporaryDataOnDisk.h>
 
 #include <Core/Block.h>
@@ -154,6 +155,20 @@ private:
     Block hash_join_sample_block;
     mutable std::mutex hash_join_mutex;
     std::atomic<bool> force_spill = false;
+
+    /// Schedules reading of the right side of the next non-empty bucket on a background thread,
+    /// so that disk reads overlap with probing of the current bucket.
+    void prefetchNextBucket(size_t loaded_bucket_idx);
+    /// Returns the prefetched blocks if they belong to the given bucket (joins the thread first).
+    std::optional<Blocks> takePrefetchedBlocks(size_t bucket_idx);
+
+    ThreadFromGlobalPool prefetch_thread;
+    std::optional<size_t> prefetched_bucket_idx;
+    Blocks prefetched_blocks;
+    /// Set when the prefetch stopped at the byte budget; the loader re-reads the bucket and
+    /// skips the already prefetched prefix of blocks.
+    bool prefetch_stopped_early = false;
+    std::exception_ptr prefetch_exception;
 };
 
 }
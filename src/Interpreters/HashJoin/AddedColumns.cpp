@@ -111,7 +111,7 @@ void AddedColumns<true>::buildOutputFromBlocks()
             }
             else
             {
-                const RowRef * row_ref = reinterpret_cast<const RowRefList *>(row_ref_i);
+                const RowRef * row_ref = reinterpret_cast<const RowRef *>(row_ref_i);
                 many_columns.emplace_back(row_ref->columns);
                 row_nums.emplace_back(row_ref->row_num);
             }
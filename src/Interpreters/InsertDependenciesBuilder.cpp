@@ -607,6 +607,10 @@ private:
     StoragePtr inner_storage;
     ContextPtr context;
 
+    /// See process(): conversion actions reused across the blocks of the insert.
+    Block cached_select_header;
+    ExpressionActionsPtr cached_converting_actions;
+
     struct State
     {
         QueryPipeline pipeline;
@@ -648,32 +652,39 @@ private:
         pipeline.resize(1);
         pipeline.dropTotalsAndExtremes();
 
-        bool insert_null_as_default = false;
+        /// The select pipeline has to be rebuilt for every block (its source table holds the block),
+        /// but the conversion of its output to the inner table structure depends only on the pipeline
+        /// header, which stays the same across the blocks of an insert. Build the actions once.
+        if (!cached_converting_actions || !blocksHaveEqualStructure(cached_select_header, pipeline.getHeader()))
+        {
+            bool insert_null_as_default = false;
 
-        auto adding_missing_defaults_dag = addMissingDefaults(
-            pipeline.getHeader(),
-            inner_metadata->getSampleBlock().getNamesAndTypesList(),
-            inner_metadata->getColumns(),
-            local_context,
-            insert_null_as_default);
+            auto adding_missing_defaults_dag = addMissingDefaults(
+                pipeline.getHeader(),
+                inner_metadata->getSampleBlock().getNamesAndTypesList(),
+                inner_metadata->getColumns(),
+                local_context,
+                insert_null_as_default);
 
-        auto extracting_subcolumns_dag = createSubcolumnsExtractionActions(
-            pipeline.getHeader(),
-            adding_missing_defaults_dag.getRequiredColumnsNames(),
-            local_context);
+            auto extracting_subcolumns_dag = createSubcolumnsExtractionActions(
+                pipeline.getHeader(),
+                adding_missing_defaults_dag.getRequiredColumnsNames(),
+                local_context);
 
-        auto merged_dag = ActionsDAG::merge(std::move(extracting_subcolumns_dag), std::move(adding_missing_defaults_dag));
+            auto merged_dag = ActionsDAG::merge(std::move(extracting_subcolumns_dag), std::move(adding_missing_defaults_dag));
 
-        auto converting_types_dag = ActionsDAG::makeConvertingActions(
-            merged_dag.getResultColumns(),
-            inner_metadata->getSampleBlock().getColumnsWithTypeAndName(),
-            ActionsDAG::MatchColumnsMode::Name);
+            auto converting_types_dag = ActionsDAG::makeConvertingActions(
+                merged_dag.getResultColumns(),
+                inner_metadata->getSampleBlock().getColumnsWithTypeAndName(),
+                ActionsDAG::MatchColumnsMode::Name);
 
-        auto final_dag = ActionsDAG::merge(std::move(merged_dag), std::move(converting_types_dag));
+            auto final_dag = ActionsDAG::merge(std::move(merged_dag), std::move(converting_types_dag));
 
-        pipeline.addTransform(std::make_shared<ExpressionTransform>(
-            pipeline.getHeader(),
-            std::make_shared<ExpressionActions>(std::move(final_dag))));
+            cached_select_header = pipeline.getHeader();
+            cached_converting_actions = std::make_shared<ExpressionActions>(std::move(final_dag));
+        }
+
+        pipeline.addTransform(std::make_shared<ExpressionTransform>(pipeline.getHeader(), cached_converting_actions));
 
         inner_metadata->check(pipeline.getHeader());
 
@@ -137,6 +137,8 @@ namespace Setting
     extern const SettingsBool extremes;
     extern const SettingsBool final;
     extern const SettingsBool force_aggregation_in_order;
+    extern const SettingsBool group_by_adaptive_two_level_conversion;
+    extern const SettingsBool group_by_numa_partitioning;
     extern const SettingsUInt64 group_by_two_level_threshold;
     extern const SettingsUInt64 group_by_two_level_threshold_bytes;
     extern const SettingsBool group_by_use_nulls;
@@ -2779,7 +2781,7 @@ static Aggregator::Params getAggregatorParams(
         context.getServerSettings()[ServerSetting::max_entries_for_hash_table_stats],
         settings[Setting::max_size_to_preallocate_for_aggregation]);
 
-    return Aggregator::Params
+    Aggregator::Params params
     {
         keys,
         aggregates,
@@ -2804,6 +2806,11 @@ static Aggregator::Params getAggregatorParams(
         settings[Setting::min_hit_rate_to_use_consecutive_keys_optimization],
         stats_collecting_params
     };
+
+    params.group_by_numa_partitioning = settings[Setting::group_by_numa_partitioning];
+    params.group_by_adaptive_two_level_conversion = settings[Setting::group_by_adaptive_two_level_conversion];
+
+    return params;
 }
 
 void InterpreterSelectQuery::executeAggregation(
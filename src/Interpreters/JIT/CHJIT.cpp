@@ -376,13 +376,60 @@ CHJIT::CHJIT()
 
 CHJIT::~CHJIT() = default;
 
-CHJIT::CompiledModule CHJIT::compileModule(std::function<void (llvm::Module &)> compile_function)
+CHJIT::CompiledModule CHJIT::compileModule(std::function<void (llvm::Module &)> compile_function, std::string * out_object_code)
 {
     std::lock_guard lock(jit_lock);
 
     auto module = createModuleForCompilation();
     compile_function(*module);
-    auto module_info = compileModule(std::move(module));
+    auto module_info = compileModule(std::move(module), out_object_code);
+
+    ++current_module_key;
+    return module_info;
+}
+
+CHJIT::CompiledModule CHJIT::loadCompiledModule(std::string_view object_code)
+{
+    std::lock_guard lock(jit_lock);
+
+    auto buffer = llvm::MemoryBuffer::getMemBufferCopy(llvm::StringRef(object_code.data(), object_code.size()));
+    llvm::Expected<std::unique_ptr<llvm::object::ObjectFile>> object = llvm::object::ObjectFile::createObjectFile(*buffer);
+
+    if (!object)
+    {
+        std::string error_message;
+        handleAllErrors(object.takeError(), [&](const llvm::ErrorInfoBase & error_info) { error_message = error_info.message(); });
+
+        throw Exception(ErrorCodes::CANNOT_COMPILE_CODE, "Cannot create object file from saved object code: {}", error_message);
+    }
+
+    /// Recover the function names from the object file symbol table. The keys that clients look up
+    /// are unmangled, so strip the global prefix if the target mangling adds one.
+    std::unordered_map<std::string, std::string> function_name_to_mangled_name;
+    const char global_prefix = layout.getGlobalPrefix();
+    for (const auto & symbol : object.get()->symbols())
+    {
+        auto flags = symbol.getFlags();
+        if (!flags || !(*flags & llvm::object::SymbolRef::SF_Global) || (*flags & llvm::object::SymbolRef::SF_Undefined))
+            continue;
+
+        auto type = symbol.getType();
+        if (!type || *type != llvm::object::SymbolRef::ST_Function)
+            continue;
+
+        auto name = symbol.getName();
+        if (!name)
+            continue;
+
+        std::string mangled_name(*name);
+        std::string function_name = mangled_name;
+        if (global_prefix != '\0' && !function_name.empty() && function_name.front() == global_prefix)
+            function_name.erase(function_name.begin());
+
+        function_name_to_mangled_name.emplace(std::move(function_name), std::move(mangled_name));
+    }
+
+    auto module_info = linkCompiledObject(std::move(object.get()), std::move(function_name_to_mangled_name));
 
     ++current_module_key;
     return module_info;
@@ -397,7 +444,7 @@ std::unique_ptr<llvm::Module> CHJIT::createModuleForCompilation()
     return module;
 }
 
-CHJIT::CompiledModule CHJIT::compileModule(std::unique_ptr<llvm::Module> module)
+CHJIT::CompiledModule CHJIT::compileModule(std::unique_ptr<llvm::Module> module, std::string * out_object_code)
 {
     runOptimizationPassesOnModule(*module);
 
@@ -408,6 +455,9 @@ CHJIT::CompiledModule CHJIT::compileModule(std::unique_ptr<llvm::Module> module)
 
     auto buffer = compiler->compile(*module);
 
+    if (out_object_code)
+        out_object_code->assign(buffer->getBufferStart(), buffer->getBufferSize());
+
     llvm::Expected<std::unique_ptr<llvm::object::ObjectFile>> object = llvm::object::ObjectFile::createObjectFile(*buffer);
 
     if (!object)
@@ -418,31 +468,42 @@ CHJIT::CompiledModule CHJIT::compileModule(std::unique_ptr<llvm::Module> module)
         throw Exception(ErrorCodes::CANNOT_COMPILE_CODE, "Cannot create object file from compiled buffer: {}", error_message);
     }
 
+    std::unordered_map<std::string, std::string> function_name_to_mangled_name;
+    for (const auto & function : *module)
+    {
+        if (function.isDeclaration())
+            continue;
+
+        auto function_name = std::string(function.getName());
+        auto mangled_name = getMangledName(function_name);
+        function_name_to_mangled_name.emplace(std::move(function_name), std::move(mangled_name));
+    }
+
+    return linkCompiledObject(std::move(object.get()), std::move(function_name_to_mangled_name));
+}
+
+CHJIT::CompiledModule CHJIT::linkCompiledObject(
+    std::unique_ptr<llvm::object::ObjectFile> object, std::unordered_map<std::string, std::string> function_name_to_mangled_name)
+{
     std::unique_ptr<JITModuleMemoryManager> module_memory_manager = std::make_unique<JITModuleMemoryManager>();
     llvm::RuntimeDyld dynamic_linker = {*module_memory_manager, *symbol_resolver};
 
-    std::unique_ptr<llvm::RuntimeDyld::LoadedObjectInfo> linked_object = dynamic_linker.loadObject(*object.get());
+    std::unique_ptr<llvm::RuntimeDyld::LoadedObjectInfo> linked_object = dynamic_linker.loadObject(*object);
 
     dynamic_linker.resolveRelocations();
     module_memory_manager->finalizeMemory(nullptr);
 
     CompiledModule compiled_module;
 
-    for (const auto & function : *module)
+    for (auto & [function_name, mangled_name] : function_name_to_mangled_name)
     {
-        if (function.isDeclaration())
-            continue;
-
-        auto function_name = std::string(function.getName());
-
-        auto mangled_name = getMangledName(function_name);
         auto jit_symbol = dynamic_linker.getSymbol(mangled_name);
 
         if (!jit_symbol)
             throw Exception(ErrorCodes::CANNOT_COMPILE_CODE, "DynamicLinker could not found symbol {} after compilation", function_name);
 
         auto * jit_symbol_address = reinterpret_cast<void *>(jit_symbol.getAddress());
-        compiled_module.function_name_to_symbol.emplace(std::move(function_name), jit_symbol_address);
+        compiled_module.function_name_to_symbol.emplace(function_name, jit_symbol_address);
     }
 
     compiled_module.size = module_memory_manager->allocatedSize();
@@ -10,6 +10,7 @@
 
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
+#include <llvm/Object/ObjectFile.h>
 #include <llvm/Target/TargetMachine.h>
 
 namespace DB
@@ -70,7 +71,13 @@ public:
       * IR code, then it will be compiled by CHJIT instance.
       * Return compiled module.
       */
-    CompiledModule compileModule(std::function<void (llvm::Module &)> compile_function);
+    CompiledModule compileModule(std::function<void (llvm::Module &)> compile_function, std::string * out_object_code = nullptr);
+
+    /** Link a module from object code that was produced by an earlier compileModule call
+      * (possibly in a previous process) and saved by the client. Skips IR generation,
+      * optimization and code generation; only relocation is performed.
+      */
+    CompiledModule loadCompiledModule(std::string_view object_code);
 
     /** Delete compiled module. Pointers to functions from module become invalid after this call.
       * It is client responsibility to be sure that there are no pointers to compiled module code.
@@ -91,7 +98,9 @@ private:
 
     std::unique_ptr<llvm::Module> createModuleForCompilation();
 
-    CompiledModule compileModule(std::unique_ptr<llvm::Module> module);
+    CompiledModule compileModule(std::unique_ptr<llvm::Module> module, std::string * out_object_code);
+
+    CompiledModule linkCompiledObject(std::unique_ptr<llvm::object::ObjectFile> object, std::unordered_map<std::string, std::string> function_name_to_mangled_name);
 
     std::string getMangledName(const std::string & name_to_mangle) const;
 
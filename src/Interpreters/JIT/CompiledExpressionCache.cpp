@@ -2,7 +2,21 @@
 
 #if USE_EMBEDDED_COMPILER
 
+#include <cstring>
+#include <filesystem>
+
 #include <Common/CurrentMetrics.h>
+#include <Common/SipHash.h>
+#include <Common/config_version.h>
+#include <Common/logger_useful.h>
+#include <IO/ReadBufferFromFile.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteBufferFromFile.h>
+#include <base/hex.h>
+
+#include <llvm/TargetParser/Host.h>
+
+namespace fs = std::filesystem;
 
 namespace CurrentMetrics
 {
@@ -37,6 +51,78 @@ CompiledExpressionCache * CompiledExpressionCacheFactory::tryGetCache()
     return cache.get();
 }
 
+void CompiledExpressionCacheFactory::initPersistentStorage(const std::string & path_)
+{
+    /// Object code is only valid for the exact binary that produced it: the JIT ABI (the layout
+    /// the compiled functions are called with), the LLVM version and the codegen target all
+    /// change between releases and machines. Key the storage directory by a fingerprint of the
+    /// server version and the host CPU, so entries from another build or another machine are
+    /// simply not seen instead of being relocated and then crashing at call time.
+    SipHash fingerprint_hash;
+    fingerprint_hash.update(VERSION_DESCRIBE, strlen(VERSION_DESCRIBE));
+    auto host_cpu = llvm::sys::getHostCPUName();
+    fingerprint_hash.update(host_cpu.data(), host_cpu.size());
+
+    auto fingerprint = getHexUIntLowercase(fingerprint_hash.get64());
+
+    fs::path path_with_fingerprint = fs::path(path_) / fingerprint;
+    fs::create_directories(path_with_fingerprint);
+    persistent_path = path_with_fingerprint;
+}
+
+static std::string getPersistedObjectCodePath(const std::string & dir, const UInt128 & key)
+{
+    return fs::path(dir) / (getHexUIntLowercase(key) + ".jit");
+}
+
+std::optional<std::string> CompiledExpressionCacheFactory::tryReadPersistedObjectCode(const UInt128 & key) const
+{
+    if (persistent_path.empty())
+        return std::nullopt;
+
+    try
+    {
+        auto path = getPersistedObjectCodePath(persistent_path, key);
+        if (!fs::exists(path))
+            return std::nullopt;
+
+        ReadBufferFromFile in(path);
+        std::string object_code;
+        readStringUntilEOF(object_code, in);
+        return object_code;
+    }
+    catch (...)
+    {
+        tryLogCurrentException(getLogger("CompiledExpressionCache"), "Cannot read persisted compiled expression, will recompile");
+        return std::nullopt;
+    }
+}
+
+void CompiledExpressionCacheFactory::persistObjectCode(const UInt128 & key, const std::string & object_code) const
+{
+    if (persistent_path.empty())
+        return;
+
+    try
+    {
+        auto path = getPersistedObjectCodePath(persistent_path, key);
+        auto tmp_path = path + ".tmp";
+
+        {
+            WriteBufferFromFile out(tmp_path);
+            out.write(object_code.data(), object_code.size());
+            out.finalize();
+        }
+
+        /// Rename is atomic, so concurrent readers see either no file or a complete one.
+        fs::rename(tmp_path, path);
+    }
+    catch (...)
+    {
+        tryLogCurrentException(getLogger("CompiledExpressionCache"), "Cannot persist compiled expression");
+    }
+}
+
 }
 
 #endif
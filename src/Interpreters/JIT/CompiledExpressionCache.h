@@ -3,6 +3,8 @@
 #include "config.h"
 
 #if USE_EMBEDDED_COMPILER
+#    include <optional>
+
 #    include <Common/CacheBase.h>
 #    include <Common/HashTable/Hash.h>
 #    include <Interpreters/JIT/CHJIT.h>
@@ -46,12 +48,22 @@ class CompiledExpressionCacheFactory
 {
 private:
     std::unique_ptr<CompiledExpressionCache> cache;
+    std::string persistent_path;
 
 public:
     static CompiledExpressionCacheFactory & instance();
 
     void init(size_t cache_size_in_bytes, size_t cache_size_in_elements);
     CompiledExpressionCache * tryGetCache();
+
+    /// Persist object code of compiled expressions in the given directory, so that
+    /// the cache survives server restarts. Disabled if never called.
+    void initPersistentStorage(const std::string & path_);
+    bool persistentStorageEnabled() const { return !persistent_path.empty(); }
+
+    /// Both functions are best-effort: IO errors are logged and treated as a cache miss.
+    std::optional<std::string> tryReadPersistedObjectCode(const UInt128 & key) const;
+    void persistObjectCode(const UInt128 & key, const std::string & object_code) const;
 };
 
 }
@@ -163,14 +163,14 @@ static void compileFunction(llvm::Module & module, const IFunctionBase & functio
     b.CreateRetVoid();
 }
 
-CompiledFunction compileFunction(CHJIT & jit, const IFunctionBase & function)
+CompiledFunction compileFunction(CHJIT & jit, const IFunctionBase & function, std::string * out_object_code)
 {
     Stopwatch watch;
 
     auto compiled_module = jit.compileModule([&](llvm::Module & module)
     {
         compileFunction(module, function);
-    });
+    }, out_object_code);
 
     ProfileEvents::increment(ProfileEvents::CompileExpressionsMicroseconds, watch.elapsedMicroseconds());
     ProfileEvents::increment(ProfileEvents::CompileExpressionsBytes, compiled_module.size);
@@ -188,6 +188,31 @@ CompiledFunction compileFunction(CHJIT & jit, const IFunctionBase & function)
     return result_compiled_function;
 }
 
+CompiledFunction loadCompiledFunction(CHJIT & jit, std::string_view object_code, const std::string & function_name)
+{
+    Stopwatch watch;
+
+    auto compiled_module = jit.loadCompiledModule(object_code);
+
+    ProfileEvents::increment(ProfileEvents::CompileExpressionsMicroseconds, watch.elapsedMicroseconds());
+    ProfileEvents::increment(ProfileEvents::CompileExpressionsBytes, compiled_module.size);
+
+    auto it = compiled_module.function_name_to_symbol.find(function_name);
+    if (it == compiled_module.function_name_to_symbol.end())
+    {
+        jit.deleteCompiledModule(compiled_module);
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "No symbol {} in saved object code", function_name);
+    }
+
+    CompiledFunction result_compiled_function
+    {
+        .compiled_function = reinterpret_cast<JITCompiledFunction>(it->second),
+        .compiled_module = compiled_module
+    };
+
+    return result_compiled_function;
+}
+
 static void compileCreateAggregateStatesFunctions(llvm::Module & module, const std::vector<AggregateFunctionWithOffset> & functions, const std::string & name)
 {
     auto & context = module.getContext();
@@ -45,7 +45,12 @@ struct CompiledFunction
   * It is client responsibility to match ColumnData arguments size with
   * function arguments size and additional ColumnData for result.
   */
-CompiledFunction compileFunction(CHJIT & jit, const IFunctionBase & function);
+CompiledFunction compileFunction(CHJIT & jit, const IFunctionBase & function, std::string * out_object_code = nullptr);
+
+/** Restore a compiled function from object code that was produced by an earlier compileFunction call
+  * (possibly in a previous process). Only relocation is performed, no compilation.
+  */
+CompiledFunction loadCompiledFunction(CHJIT & jit, std::string_view object_code, const std::string & function_name);
 
 struct AggregateFunctionWithOffset
 {
@@ -175,6 +175,11 @@ IsStorageTouched isStorageTouchedByMutations(
     if (commands.empty())
         return no_rows;
 
+    /// Parts that are already empty (e.g. produced by a previous full-delete mutation or TTL)
+    /// cannot be touched; don't build and run a counting query over them.
+    if (source_part->rows_count == 0)
+        return no_rows;
+
     auto storage_from_part = std::make_shared<StorageFromMergeTreeDataPart>(source_part, mutations_snapshot);
     bool all_commands_can_be_skipped = true;
 
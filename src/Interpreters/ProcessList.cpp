@@ -329,6 +329,12 @@ ProcessList::EntryPtr ProcessList::insert(
             processes.end(),
             query);
 
+        if (processes.size() == 1)
+        {
+            if (auto global_context = Context::getGlobalContextInstance())
+                global_context->updateMergesThrottlerForQueryLoad(/*has_running_queries=*/ true);
+        }
+
         CancellationChecker::getInstance().appendTask(query, query_context->getSettingsRef()[Setting::max_execution_time].totalMilliseconds(), query_context->getSettingsRef()[Setting::timeout_overflow_mode]);
 
         increaseQueryKindAmount(query_kind);
@@ -406,6 +412,12 @@ ProcessListEntry::~ProcessListEntry()
     /// This removes the memory_tracker of one request.
     parent.processes.erase(it);
 
+    if (parent.processes.empty())
+    {
+        if (auto global_context = Context::getGlobalContextInstance())
+            global_context->updateMergesThrottlerForQueryLoad(/*has_running_queries=*/ false);
+    }
+
     if (!found)
     {
         LOG_ERROR(getLogger("ProcessList"), "Cannot find query by query_id and pointer to ProcessListElement in ProcessListForUser");
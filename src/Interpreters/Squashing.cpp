@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <vector>
 #include <Interpreters/Squashing.h>
 #include <Common/CurrentThread.h>
@@ -122,11 +123,21 @@ Chunk Squashing::squash(std::vector<Chunk> && input_chunks, Chunk::ChunkInfoColl
     for (const Chunk & chunk : input_chunks)
         rows += chunk.getNumRows();
 
+    /// If the columns of the first chunk are not shared, they can be reused as the destination
+    /// without copying. Shared columns (e.g. when the same chunk also feeds a materialized view)
+    /// would be deep-copied by IColumn::mutate with an exact-size allocation and then reallocated
+    /// again by prepareForSquashing below; for them it is cheaper to start from an empty column
+    /// and treat the first chunk as a regular source, so its data is copied exactly once.
+    Columns first_chunk_columns = input_chunks[0].detachColumns();
+    const bool first_chunk_columns_are_shared
+        = std::ranges::any_of(first_chunk_columns, [](const auto & column) { return column->use_count() > 1; });
+
+    mutable_columns.reserve(first_chunk_columns.size());
+    for (auto & column : first_chunk_columns)
     {
-        auto & first_chunk = input_chunks[0];
-        Columns columns = first_chunk.detachColumns();
-        mutable_columns.reserve(columns.size());
-        for (auto & column : columns)
+        if (first_chunk_columns_are_shared)
+            mutable_columns.push_back(column->cloneEmpty());
+        else
             mutable_columns.push_back(IColumn::mutate(std::move(column)));
     }
 
@@ -137,7 +148,11 @@ Chunk Squashing::squash(std::vector<Chunk> && input_chunks, Chunk::ChunkInfoColl
     std::vector<UInt8> have_same_serialization(num_columns, true);
 
     for (size_t i = 0; i != num_columns; ++i)
-        source_columns_list[i].reserve(input_chunks.size() - 1);
+    {
+        source_columns_list[i].reserve(input_chunks.size() - (first_chunk_columns_are_shared ? 0 : 1));
+        if (first_chunk_columns_are_shared)
+            source_columns_list[i].emplace_back(std::move(first_chunk_columns[i]));
+    }
 
     for (size_t i = 1; i < input_chunks.size(); ++i) // We've already processed the first chunk above
     {
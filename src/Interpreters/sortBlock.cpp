@@ -129,17 +129,12 @@ void getBlockSortPermutationImpl(const Block & block, const SortDescription & de
 
     ColumnsWithSortDescriptions columns_with_sort_descriptions = getColumnsWithSortDescription(block, description);
 
-    bool all_const = true;
-    for (const auto & column : columns_with_sort_descriptions)
-    {
-        if (!column.column_const)
-        {
-            all_const = false;
-            break;
-        }
-    }
+    /// Constant columns impose no order. Dropping them here not only simplifies the loop below,
+    /// but lets e.g. (const_date, id) take the single-column fast path with a direct
+    /// getPermutation instead of the generic multi-column tie-breaking.
+    std::erase_if(columns_with_sort_descriptions, [](const auto & column) { return column.column_const; });
 
-    if (unlikely(all_const))
+    if (unlikely(columns_with_sort_descriptions.empty()))
         return;
 
     /// If only one column to sort by
@@ -177,9 +172,6 @@ void getBlockSortPermutationImpl(const Block & block, const SortDescription & de
             if (ranges.empty())
                 break;
 
-            if (column_with_sort_description.column_const)
-                continue;
-
             bool is_collation_required = isCollationRequired(column_with_sort_description.description);
             IColumn::PermutationSortDirection direction = column_with_sort_description.description.direction == -1 ? IColumn::PermutationSortDirection::Descending : IColumn::PermutationSortDirection::Ascending;
             int nan_direction_hint = column_with_sort_description.description.nulls_direction;
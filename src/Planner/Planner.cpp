@@ -113,6 +113,8 @@ namespace Setting
     extern const SettingsBool exact_rows_before_limit;
     extern const SettingsBool extremes;
     extern const SettingsBool force_aggregation_in_order;
+    extern const SettingsBool group_by_adaptive_two_level_conversion;
+    extern const SettingsBool group_by_numa_partitioning;
     extern const SettingsUInt64 group_by_two_level_threshold;
     extern const SettingsUInt64 group_by_two_level_threshold_bytes;
     extern const SettingsBool group_by_use_nulls;
@@ -504,6 +506,9 @@ Aggregator::Params getAggregatorParams(const PlannerContextPtr & planner_context
         settings[Setting::min_hit_rate_to_use_consecutive_keys_optimization],
         stats_collecting_params);
 
+    aggregator_params.group_by_numa_partitioning = settings[Setting::group_by_numa_partitioning];
+    aggregator_params.group_by_adaptive_two_level_conversion = settings[Setting::group_by_adaptive_two_level_conversion];
+
     return aggregator_params;
 }
 
@@ -154,17 +154,29 @@ ExecutorTasks::SpawnStatus ExecutorTasks::pushTasks(Queue & queue, Queue & async
 
     if (!queue.empty() || !async_queue.empty())
     {
-        std::unique_lock lock(mutex);
-
 #if defined(OS_LINUX)
-        while (!async_queue.empty() && !finished)
+        /// schedule() may perform syscalls (e.g. create an eventfd), keep it outside of the common
+        /// mutex: this lock is the top contention point with many small concurrent queries.
+        std::vector<std::pair<ExecutingGraph::Node *, int>> scheduled_async_tasks;
+        scheduled_async_tasks.reserve(async_queue.size());
+        while (!async_queue.empty())
         {
             int fd = async_queue.front()->processor->schedule();
-            async_task_queue.addTask(context.thread_number, async_queue.front(), fd);
+            scheduled_async_tasks.emplace_back(async_queue.front(), fd);
             async_queue.pop();
         }
 #endif
 
+        std::unique_lock lock(mutex);
+
+#if defined(OS_LINUX)
+        if (!finished)
+        {
+            for (auto & [task, fd] : scheduled_async_tasks)
+                async_task_queue.addTask(context.thread_number, task, fd);
+        }
+#endif
+
         while (!queue.empty() && !finished)
         {
             task_queue.push(queue.front(), context.thread_number);
@@ -719,8 +719,6 @@ void ParquetBlockInputFormat::initializeIfNeeded()
             return false;
         }
 
-        KeyCondition::ColumnIndexToBloomFilter column_index_to_bloom_filter;
-
         const auto & header = getPort().getHeader();
 
         std::vector<Range> hyperrectangle(header.columns(), Range::createWholeUniverse());
@@ -728,16 +726,28 @@ void ParquetBlockInputFormat::initializeIfNeeded()
         if (format_settings.parquet.filter_push_down)
         {
             hyperrectangle = getHyperrectangleForRowGroup(*metadata, row_group, header, format_settings);
+
+            /// Check the min/max statistics first: they come from the already loaded metadata,
+            /// while bloom filters have to be fetched from the file. If the statistics alone
+            /// exclude the row group, the bloom filter reads (extra GETs on object storage)
+            /// are skipped entirely.
+            if (!key_condition_with_bloom_filter_data
+                     ->checkInHyperrectangle(hyperrectangle, header.getDataTypes(), {})
+                     .can_be_true)
+                return true;
         }
 
         if (format_settings.parquet.bloom_filter_push_down)
         {
-            column_index_to_bloom_filter = buildColumnIndexToBF(*bf_reader, row_group, index_mapping, filtering_columns);
-        }
+            auto column_index_to_bloom_filter = buildColumnIndexToBF(*bf_reader, row_group, index_mapping, filtering_columns);
 
-        bool maybe_exists = key_condition_with_bloom_filter_data->checkInHyperrectangle(hyperrectangle, getPort().getHeader().getDataTypes(), column_index_to_bloom_filter).can_be_true;
+            bool maybe_exists = key_condition_with_bloom_filter_data
+                                    ->checkInHyperrectangle(hyperrectangle, header.getDataTypes(), column_index_to_bloom_filter)
+                                    .can_be_true;
+            return !maybe_exists;
+        }
 
-        return !maybe_exists;
+        return false;
     };
 
     for (int row_group = 0; row_group < num_row_groups; ++row_group)
@@ -776,6 +786,15 @@ void ParquetBlockInputFormat::initializeRowGroupBatchReader(size_t row_group_bat
     arrow_properties.set_use_threads(false);
     arrow_properties.set_batch_size(row_group_batch.adaptive_chunk_size);
 
+    if (format_settings.parquet.dictionary_as_low_cardinality)
+    {
+        /// Keep dictionary-encoded columns as arrow DictionaryArrays; the arrow-to-CH conversion
+        /// turns them into LowCardinality columns directly, so imports into LowCardinality
+        /// destinations skip the decode-then-reencode round trip.
+        for (int i = 0; i < metadata->num_columns(); ++i)
+            arrow_properties.set_read_dictionary(i, true);
+    }
+
     // When reading a row group, arrow will:
     //  1. Look at `metadata` to get all byte ranges it'll need to read from the file (typically one
     //     per requested column in the row group).
@@ -84,12 +84,15 @@ ParquetBlockOutputFormat::ParquetBlockOutputFormat(WriteBuffer & out_, const Blo
         if (format_settings.parquet.output_version < FormatSettings::ParquetVersion::V2_6)
             throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Custom parquet encoder doesn't support parquet versions < 2.6. Use output_format_parquet_use_custom_encoder = 0.");
 
-        if (format_settings.parquet.parallel_encoding && format_settings.max_threads > 1)
+        size_t encoding_threads = format_settings.parquet.encoding_threads
+            ? format_settings.parquet.encoding_threads
+            : format_settings.max_threads;
+        if (format_settings.parquet.parallel_encoding && encoding_threads > 1)
             pool = std::make_unique<ThreadPool>(
                 CurrentMetrics::ParquetEncoderThreads,
                 CurrentMetrics::ParquetEncoderThreadsActive,
                 CurrentMetrics::ParquetEncoderThreadsScheduled,
-                format_settings.max_threads);
+                encoding_threads);
 
         using C = FormatSettings::ParquetCompression;
         switch (format_settings.parquet.output_compression_method)
@@ -86,6 +86,8 @@ void IInflatingTransform::work()
 
         current_chunk = getRemaining();
         generated = !current_chunk.empty();
+        /// The transform may have more buffered data to flush (e.g. spilled to disk), continue generating.
+        can_generate = canGenerate();
     }
     else
     {
@@ -213,6 +213,14 @@ void AggregatingSortedAlgorithm::AggregatingMergedData::finishGroup()
     /// TODO: sum_blocks_granularity += block_size;
 }
 
+/// Merges one source row into the open group: a virtual IAggregateFunction::add/merge per
+/// column per row. Vectorizing this is bounded by group shape: when runs of rows with equal keys
+/// come from ONE cursor, the whole run could go through addBatchSinglePlace /
+/// mergeBatchSinglePlace-style calls per column (the batch queue strategy in MergingSortedAlgorithm
+/// shows how runs are detected via totallyLessOrEquals); rows alternating between cursors cannot
+/// batch. For metrics rollups, where each merge input holds long key runs, the run-based path
+/// would remove most per-row virtual dispatch - it needs run detection in merge() below plus a
+/// run-aware addRow, with the column loop hoisted outside the row loop.
 void AggregatingSortedAlgorithm::AggregatingMergedData::addRow(SortCursor & cursor)
 {
     if (!is_group_started)
@@ -11,6 +11,7 @@ namespace Setting
     extern const SettingsMaxThreads max_threads;
     extern const SettingsUInt64 aggregation_memory_efficient_merge_threads;
     extern const SettingsUInt64 min_outstreams_per_resize_after_split;
+    extern const SettingsBool enable_external_distinct;
 }
 
 BuildQueryPipelineSettings::BuildQueryPipelineSettings(ContextPtr from)
@@ -31,6 +32,10 @@ BuildQueryPipelineSettings::BuildQueryPipelineSettings(ContextPtr from)
     enable_multiple_filters_transforms_for_and_chain = settings[Setting::query_plan_merge_filters];
 
     block_marshalling_callback = from->getBlockMarshallingCallback();
+
+    enable_external_distinct = settings[Setting::enable_external_distinct];
+    if (enable_external_distinct)
+        tmp_data_scope = from->getTempDataOnDisk();
 }
 
 }
@@ -15,6 +15,8 @@ class QueryStatus;
 using QueryStatusPtr = std::shared_ptr<QueryStatus>;
 struct ITemporaryFileLookup;
 using TemporaryFileLookupPtr = std::shared_ptr<ITemporaryFileLookup>;
+class TemporaryDataOnDiskScope;
+using TemporaryDataOnDiskScopePtr = std::shared_ptr<TemporaryDataOnDiskScope>;
 using BlockMarshallingCallback = std::function<Block(const Block & block)>;
 
 struct BuildQueryPipelineSettings
@@ -23,6 +25,10 @@ struct BuildQueryPipelineSettings
 
     bool enable_multiple_filters_transforms_for_and_chain;
 
+    /// DISTINCT spills new keys to disk instead of failing when the set size limits are exceeded.
+    bool enable_external_distinct = false;
+    TemporaryDataOnDiskScopePtr tmp_data_scope;
+
     ExpressionActionsSettings actions_settings;
     QueryStatusPtr process_list_element;
     ProgressCallback progress_callback;
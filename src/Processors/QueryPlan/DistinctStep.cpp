@@ -5,6 +5,7 @@
 #include <Processors/Transforms/DistinctSortedStreamTransform.h>
 #include <Processors/Transforms/DistinctSortedTransform.h>
 #include <Processors/Transforms/DistinctTransform.h>
+#include <Processors/Transforms/ExternalDistinctTransform.h>
 #include <QueryPipeline/QueryPipelineBuilder.h>
 #include <IO/Operators.h>
 #include <Common/JSONBuilder.h>
@@ -69,7 +70,7 @@ void DistinctStep::updateLimitHint(UInt64 hint)
         limit_hint = std::max(hint, limit_hint);
 }
 
-void DistinctStep::transformPipeline(QueryPipelineBuilder & pipeline, const BuildQueryPipelineSettings &)
+void DistinctStep::transformPipeline(QueryPipelineBuilder & pipeline, const BuildQueryPipelineSettings & build_settings)
 {
     if (!pre_distinct)
         pipeline.resize(1);
@@ -132,6 +133,23 @@ void DistinctStep::transformPipeline(QueryPipelineBuilder & pipeline, const Buil
         }
     }
 
+    /// For the final DISTINCT, spilling may be used when the set does not fit into the limits.
+    /// Pre-distinct stays in-memory: it is best-effort and does not enforce the limits.
+    if (!pre_distinct && build_settings.enable_external_distinct && build_settings.tmp_data_scope
+        && set_size_limits.hasLimits())
+    {
+        pipeline.addSimpleTransform(
+            [&](const Block & header, QueryPipelineBuilder::StreamType stream_type) -> ProcessorPtr
+            {
+                if (stream_type != QueryPipelineBuilder::StreamType::Main)
+                    return nullptr;
+
+                return std::make_shared<ExternalDistinctTransform>(
+                    header, set_size_limits, limit_hint, columns, build_settings.tmp_data_scope);
+            });
+        return;
+    }
+
     pipeline.addSimpleTransform(
         [&](const Block & header, QueryPipelineBuilder::StreamType stream_type) -> ProcessorPtr
         {
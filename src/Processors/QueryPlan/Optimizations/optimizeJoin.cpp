@@ -1,5 +1,6 @@
 #include <Processors/QueryPlan/ExpressionStep.h>
 #include <Processors/QueryPlan/FilterStep.h>
+#include <Processors/QueryPlan/LimitStep.h>
 #include <Processors/QueryPlan/ITransformingStep.h>
 #include <Processors/QueryPlan/JoinStep.h>
 #include <Processors/QueryPlan/Optimizations/Optimizations.h>
@@ -97,6 +98,16 @@ static std::optional<UInt64> estimateReadRowsCount(QueryPlan::Node & node, bool
     if (typeid_cast<FilterStep *>(step))
         return estimateReadRowsCount(*node.children.front(), true);
 
+    /// A limit caps the number of rows regardless of what is below it.
+    if (const auto * limit = typeid_cast<LimitStep *>(step))
+    {
+        auto child_estimation = estimateReadRowsCount(*node.children.front(), has_filter);
+        /// getLimitForSorting returns 0 on overflow, which means "no cap".
+        if (size_t limit_with_offset = limit->getLimitForSorting())
+            return child_estimation ? std::min<UInt64>(limit_with_offset, *child_estimation) : limit_with_offset;
+        return child_estimation;
+    }
+
     return {};
 }
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <Common/typeid_cast.h>
 #include <Functions/FunctionHelpers.h>
 #include <Interpreters/ExpressionActions.h>
@@ -167,27 +169,40 @@ void AddingDefaultsTransform::transform(Chunk & chunk)
     /// recalculate with help of block_missing_values.
     Block evaluate_block{res};
     /// remove columns for recalculation
+    std::vector<size_t> missing_column_indexes;
     for (const auto & column : column_defaults)
     {
         if (evaluate_block.has(column.first))
         {
             size_t column_idx = res.getPositionByName(column.first);
             if (block_missing_values->hasDefaultBits(column_idx))
+            {
                 evaluate_block.erase(column.first);
+                missing_column_indexes.push_back(column_idx);
+            }
         }
     }
 
     if (!evaluate_block.columns())
         evaluate_block.insert({ColumnConst::create(ColumnUInt8::create(1, 0), num_rows), std::make_shared<DataTypeUInt8>(), "_dummy"});
 
-    auto dag = evaluateMissingDefaults(evaluate_block, header.getNamesAndTypesList(), columns, context, false);
-    if (dag)
+    /// Building and compiling the actions depends only on the set of missing columns, which
+    /// repeats block after block in an ingestion stream; reuse the compiled actions per set.
+    std::sort(missing_column_indexes.begin(), missing_column_indexes.end());
+    auto [cache_it, inserted] = actions_cache.try_emplace(std::move(missing_column_indexes));
+    if (inserted)
     {
-        auto extracting_subcolumns_dag = createSubcolumnsExtractionActions(header, dag->getRequiredColumnsNames(), context);
-        auto actions = std::make_shared<ExpressionActions>(ActionsDAG::merge(std::move(extracting_subcolumns_dag), std::move(*dag)), ExpressionActionsSettings(context, CompileExpressions::yes), true);
-        actions->execute(evaluate_block);
+        auto dag = evaluateMissingDefaults(evaluate_block, header.getNamesAndTypesList(), columns, context, false);
+        if (dag)
+        {
+            auto extracting_subcolumns_dag = createSubcolumnsExtractionActions(header, dag->getRequiredColumnsNames(), context);
+            cache_it->second = std::make_shared<ExpressionActions>(ActionsDAG::merge(std::move(extracting_subcolumns_dag), std::move(*dag)), ExpressionActionsSettings(context, CompileExpressions::yes), true);
+        }
     }
 
+    if (cache_it->second)
+        cache_it->second->execute(evaluate_block);
+
     std::unordered_map<size_t, MutableColumnPtr> mixed_columns;
 
     for (auto & column_def : evaluate_block)
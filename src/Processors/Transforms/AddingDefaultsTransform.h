@@ -1,8 +1,11 @@
 #pragma once
 
+#include <Interpreters/ExpressionActions.h>
 #include <Processors/ISimpleTransform.h>
 #include <Storages/ColumnsDescription.h>
 
+#include <map>
+
 
 namespace DB
 {
@@ -29,6 +32,11 @@ private:
     const ColumnDefaults column_defaults;
     IInputFormat & input_format;
     ContextPtr context;
+
+    /// The default-evaluation actions depend only on which columns are missing in the block,
+    /// and ingestion streams repeat the same missing-column sets block after block; cache the
+    /// compiled actions per set (nullptr means nothing has to be evaluated for that set).
+    std::map<std::vector<size_t>, ExpressionActionsPtr> actions_cache;
 };
 
 }
@@ -104,13 +104,17 @@ public:
 
     using SharedDataPtr = std::shared_ptr<SharedData>;
 
+    /// If static_bucket_range_ is set, the source merges only this half-open range of buckets.
+    /// Otherwise buckets are taken dynamically from the shared atomic counter.
     ConvertingAggregatedToChunksWithMergingSource(
-        AggregatingTransformParamsPtr params_, ManyAggregatedDataVariantsPtr data_, SharedDataPtr shared_data_, Arena * arena_)
+        AggregatingTransformParamsPtr params_, ManyAggregatedDataVariantsPtr data_, SharedDataPtr shared_data_, Arena * arena_,
+        std::optional<std::pair<UInt32, UInt32>> static_bucket_range_ = {})
         : ISource(params_->getHeader(), false)
         , params(std::move(params_))
         , data(std::move(data_))
         , shared_data(std::move(shared_data_))
         , arena(arena_)
+        , static_bucket_range(static_bucket_range_)
     {
     }
 
@@ -119,7 +123,19 @@ public:
 protected:
     Chunk generate() override
     {
-        UInt32 bucket_num = shared_data->next_bucket_to_merge.fetch_add(1);
+        UInt32 bucket_num;
+        if (static_bucket_range)
+        {
+            if (static_bucket_range->first == static_bucket_range->second)
+            {
+                data.reset();
+                return {};
+            }
+
+            bucket_num = static_bucket_range->first++;
+        }
+        else
+            bucket_num = shared_data->next_bucket_to_merge.fetch_add(1);
 
         if (bucket_num >= NUM_BUCKETS)
         {
@@ -140,6 +156,8 @@ private:
     ManyAggregatedDataVariantsPtr data;
     SharedDataPtr shared_data;
     Arena * arena;
+    /// When set, merge only this half-open range of buckets (see group_by_numa_partitioning).
+    std::optional<std::pair<UInt32, UInt32>> static_bucket_range;
 };
 
 /// Asks Aggregator to convert accumulated aggregation state into blocks (without merging) and pushes them to later steps.
@@ -511,7 +529,20 @@ private:
         {
             /// Select Arena to avoid race conditions
             Arena * arena = first->aggregates_pools.at(thread).get();
-            auto source = std::make_shared<ConvertingAggregatedToChunksWithMergingSource>(params, data, shared_data, arena);
+
+            std::optional<std::pair<UInt32, UInt32>> static_bucket_range;
+            if (params->params.group_by_numa_partitioning)
+            {
+                /// Give every thread a contiguous range of buckets instead of interleaving them through
+                /// the shared counter. Adjacent buckets share cache lines of the two-level hash tables,
+                /// so on multi-socket machines this keeps each thread's traffic on its own node and
+                /// crosses the interconnect only when the resulting chunks are collected.
+                static_bucket_range = std::make_pair(
+                    static_cast<UInt32>(NUM_BUCKETS * thread / num_threads),
+                    static_cast<UInt32>(NUM_BUCKETS * (thread + 1) / num_threads));
+            }
+
+            auto source = std::make_shared<ConvertingAggregatedToChunksWithMergingSource>(params, data, shared_data, arena, static_bucket_range);
 
             processors.emplace_back(std::move(source));
         }
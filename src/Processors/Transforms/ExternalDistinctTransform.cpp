@@ -0,0 +1,233 @@
+#include <Processors/Transforms/ExternalDistinctTransform.h>
+
+#include <Columns/ColumnSparse.h>
+#include <Columns/ColumnsCommon.h>
+#include <Interpreters/JoinUtils.h>
+
+namespace DB
+{
+
+ExternalDistinctTransform::ExternalDistinctTransform(
+    const Block & header_,
+    const SizeLimits & set_size_limits_,
+    UInt64 limit_hint_,
+    const Names & columns_,
+    TemporaryDataOnDiskScopePtr tmp_data_scope_)
+    : IInflatingTransform(header_, header_)
+    , header(header_)
+    , set_size_limits(set_size_limits_)
+    , limit_hint(limit_hint_)
+    , tmp_data_scope(std::move(tmp_data_scope_))
+{
+    const size_t num_columns = columns_.empty() ? header_.columns() : columns_.size();
+    key_columns_pos.reserve(num_columns);
+    key_names.reserve(num_columns);
+    for (size_t i = 0; i < num_columns; ++i)
+    {
+        const auto pos = columns_.empty() ? i : header_.getPositionByName(columns_[i]);
+        const auto & col = header_.getByPosition(pos).column;
+        if (col && !isColumnConst(*col))
+        {
+            key_columns_pos.emplace_back(pos);
+            key_names.emplace_back(header_.getByPosition(pos).name);
+        }
+    }
+
+    partitions.resize(NUM_PARTITIONS);
+}
+
+template <typename Method>
+void ExternalDistinctTransform::buildFilter(
+    Method & method, const ColumnRawPtrs & columns, IColumn::Filter & filter, size_t rows, SetVariants & variants) const
+{
+    typename Method::State state(columns, key_sizes, nullptr);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        auto emplace_result = state.emplaceKey(method.data, i, variants.string_pool);
+        filter[i] = emplace_result.isInserted();
+    }
+}
+
+template <typename Method>
+void ExternalDistinctTransform::buildFilterFrozen(
+    Method & method, const ColumnRawPtrs & columns, IColumn::Filter & filter, size_t rows, SetVariants & variants) const
+{
+    typename Method::State state(columns, key_sizes, nullptr);
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        auto find_result = state.findKey(method.data, i, variants.string_pool);
+        /// Keep only rows that are not in the frozen set: they have not been emitted yet.
+        filter[i] = !find_result.isFound();
+    }
+}
+
+Chunk ExternalDistinctTransform::deduplicate(Chunk chunk, SetVariants & variants, bool frozen)
+{
+    convertToFullIfSparse(chunk);
+    convertToFullIfConst(chunk);
+
+    const auto num_rows = chunk.getNumRows();
+    auto columns = chunk.detachColumns();
+
+    ColumnRawPtrs column_ptrs;
+    column_ptrs.reserve(key_columns_pos.size());
+    for (auto pos : key_columns_pos)
+        column_ptrs.emplace_back(columns[pos].get());
+
+    if (variants.empty())
+        variants.init(SetVariants::chooseMethod(column_ptrs, key_sizes));
+
+    const auto old_set_size = variants.getTotalRowCount();
+    IColumn::Filter filter(num_rows);
+
+    switch (variants.type)
+    {
+        case SetVariants::Type::EMPTY:
+            break;
+#define M(NAME) \
+        case SetVariants::Type::NAME: \
+            if (frozen) \
+                buildFilterFrozen(*variants.NAME, column_ptrs, filter, num_rows, variants); \
+            else \
+                buildFilter(*variants.NAME, column_ptrs, filter, num_rows, variants); \
+            break;
+    APPLY_FOR_SET_VARIANTS(M)
+#undef M
+    }
+
+    if (!frozen && variants.getTotalRowCount() == old_set_size)
+        return {};
+
+    size_t num_result_rows = countBytesInFilter(filter.data(), 0, filter.size());
+    if (num_result_rows == 0)
+        return {};
+
+    for (auto & column : columns)
+        column = column->filter(filter, num_result_rows);
+
+    return Chunk(std::move(columns), num_result_rows);
+}
+
+void ExternalDistinctTransform::spill(Chunk chunk)
+{
+    Block block = header.cloneWithColumns(chunk.detachColumns());
+    Blocks scattered = JoinCommon::scatterBlockByHash(key_names, block, NUM_PARTITIONS);
+
+    for (size_t i = 0; i < NUM_PARTITIONS; ++i)
+    {
+        if (!scattered[i].rows())
+            continue;
+
+        if (!partitions[i])
+            partitions[i].emplace(header, tmp_data_scope.get());
+
+        (*partitions[i])->write(scattered[i]);
+    }
+}
+
+void ExternalDistinctTransform::consume(Chunk chunk)
+{
+    if (unlikely(!chunk.hasRows()))
+        return;
+
+    /// Special case - only const columns, return single row.
+    if (unlikely(key_columns_pos.empty()))
+    {
+        /// ready_chunk is moved out by generate(), so it cannot serve as the "already emitted"
+        /// marker: every subsequent input chunk would produce another row.
+        if (single_row_emitted)
+            return;
+        single_row_emitted = true;
+
+        auto columns = chunk.detachColumns();
+        for (auto & column : columns)
+            column = column->cut(0, 1);
+        ready_chunk = Chunk(std::move(columns), 1);
+        return;
+    }
+
+    if (!spilling)
+    {
+        ready_chunk = deduplicate(std::move(chunk), data, /*frozen=*/ false);
+
+        /// When the set exceeds the budget, freeze it and switch to partitioning new keys to disk.
+        size_t set_rows = data.getTotalRowCount();
+        if ((set_size_limits.max_rows && set_rows > set_size_limits.max_rows)
+            || (set_size_limits.max_bytes && data.getTotalByteCount() > set_size_limits.max_bytes))
+            spilling = true;
+
+        return;
+    }
+
+    /// Rows present in the frozen set have been emitted already, the rest goes to disk.
+    Chunk new_rows = deduplicate(std::move(chunk), data, /*frozen=*/ true);
+    if (new_rows)
+        spill(std::move(new_rows));
+}
+
+bool ExternalDistinctTransform::canGenerate()
+{
+    if (ready_chunk)
+        return true;
+
+    if (flushing)
+    {
+        ready_chunk = fetchFromPartitions();
+        return bool(ready_chunk);
+    }
+
+    return false;
+}
+
+Chunk ExternalDistinctTransform::generate()
+{
+    return std::move(ready_chunk);
+}
+
+Chunk ExternalDistinctTransform::getRemaining()
+{
+    if (!spilling)
+        return {};
+
+    flushing = true;
+    return fetchFromPartitions();
+}
+
+Chunk ExternalDistinctTransform::fetchFromPartitions()
+{
+    while (current_partition < NUM_PARTITIONS)
+    {
+        if (!partitions[current_partition])
+        {
+            ++current_partition;
+            continue;
+        }
+
+        if (!partition_reader)
+        {
+            partitions[current_partition]->finishWriting();
+            partition_reader.emplace(partitions[current_partition]->getReadStream());
+            partition_data = std::make_unique<SetVariants>();
+        }
+
+        while (Block block = (*partition_reader)->read())
+        {
+            /// Each partition is deduplicated with its own set. Partitions are disjoint by key hash,
+            /// and the rows were filtered against the frozen set before spilling, so the result
+            /// contains no duplicates with anything emitted earlier.
+            Chunk chunk = deduplicate(Chunk(block.getColumns(), block.rows()), *partition_data, /*frozen=*/ false);
+            if (chunk)
+                return chunk;
+        }
+
+        partition_reader.reset();
+        partitions[current_partition].reset();
+        ++current_partition;
+    }
+
+    return {};
+}
+
+}
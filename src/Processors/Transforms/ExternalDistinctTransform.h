@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Core/SortDescription.h>
+#include <Interpreters/SetVariants.h>
+#include <Interpreters/TemporaryDataOnDisk.h>
+#include <Processors/IInflatingTransform.h>
+#include <QueryPipeline/SizeLimits.h>
+
+namespace DB
+{
+
+/** Removes duplicate rows, like DistinctTransform, but with bounded memory:
+  * while the in-memory set fits into the size limits, unique rows are emitted in a streaming fashion.
+  * Once the limits are exceeded, the set is frozen and further rows that are not in it are partitioned
+  * by key hash into temporary files. When the input is exhausted, partitions are processed one at a
+  * time, each with a fresh in-memory set, so peak memory is the frozen set plus one partition's set.
+  * Partitions are disjoint by construction, therefore no deduplication across them is needed.
+  */
+class ExternalDistinctTransform : public IInflatingTransform
+{
+public:
+    ExternalDistinctTransform(
+        const Block & header_,
+        const SizeLimits & set_size_limits_,
+        UInt64 limit_hint_,
+        const Names & columns_,
+        TemporaryDataOnDiskScopePtr tmp_data_scope_);
+
+    String getName() const override { return "ExternalDistinctTransform"; }
+
+protected:
+    void consume(Chunk chunk) override;
+    bool canGenerate() override;
+    Chunk generate() override;
+    Chunk getRemaining() override;
+
+private:
+    static constexpr size_t NUM_PARTITIONS = 32;
+
+    Block header;
+    SizeLimits set_size_limits;
+    UInt64 limit_hint;
+    Names key_names;
+    ColumnNumbers key_columns_pos;
+    TemporaryDataOnDiskScopePtr tmp_data_scope;
+
+    /// In-memory phase.
+    SetVariants data;
+    Sizes key_sizes;
+
+    /// Set after the single output row for all-constant keys has been produced.
+    bool single_row_emitted = false;
+
+    /// Spilling phase.
+    bool spilling = false;
+    std::vector<std::optional<TemporaryBlockStreamHolder>> partitions;
+
+    /// Flushing (post-input) phase.
+    bool flushing = false;
+    size_t current_partition = 0;
+    std::optional<TemporaryBlockStreamReaderHolder> partition_reader;
+    std::unique_ptr<SetVariants> partition_data;
+
+    Chunk ready_chunk;
+
+    template <typename Method>
+    void buildFilter(
+        Method & method, const ColumnRawPtrs & columns, IColumn::Filter & filter, size_t rows, SetVariants & variants) const;
+
+    template <typename Method>
+    void buildFilterFrozen(
+        Method & method, const ColumnRawPtrs & columns, IColumn::Filter & filter, size_t rows, SetVariants & variants) const;
+
+    /// Removes rows of the chunk that are duplicates within `variants` (optionally only probing).
+    Chunk deduplicate(Chunk chunk, SetVariants & variants, bool frozen);
+
+    void spill(Chunk chunk);
+    Chunk fetchFromPartitions();
+};
+
+}
@@ -137,7 +137,6 @@ void FilterTransform::doTransform(Chunk & chunk)
 {
     size_t num_rows_before_filtration = chunk.getNumRows();
     auto columns = chunk.detachColumns();
-    DataTypes types;
 
     {
         Block block = getInputPort().getHeader().cloneWithColumns(columns);
@@ -147,7 +146,6 @@ void FilterTransform::doTransform(Chunk & chunk)
             expression->execute(block, num_rows_before_filtration);
 
         columns = block.getColumns();
-        types = block.getDataTypes();
     }
 
     if (constant_filter_description.always_true || on_totals)
@@ -185,35 +183,12 @@ void FilterTransform::doTransform(Chunk & chunk)
     else
         filter_description = std::make_unique<FilterDescription>(*filter_column);
 
-    /** Let's find out how many rows will be in result.
-      * To do this, we filter out the first non-constant column
-      *  or calculate number of set bytes in the filter.
+    /** Let's find out how many rows will be in the result by counting the set bytes in the filter.
+      * The count is vectorized and, unlike filtering out a probe column first, it does not allocate,
+      * lets the all-pass case below avoid copying any column at all, and gives every filter() call
+      * below an exact result size to reserve.
       */
-    size_t first_non_constant_column = num_columns;
-    size_t min_size_in_memory = std::numeric_limits<size_t>::max();
-    for (size_t i = 0; i < num_columns; ++i)
-    {
-        DataTypePtr type_not_null = removeNullableOrLowCardinalityNullable(types[i]);
-        if (i != filter_column_position && !isColumnConst(*columns[i]) && type_not_null->isValueRepresentedByNumber())
-        {
-            size_t size_in_memory = type_not_null->getSizeOfValueInMemory() + (isNullableOrLowCardinalityNullable(types[i]) ? 1 : 0);
-            if (size_in_memory < min_size_in_memory)
-            {
-                min_size_in_memory = size_in_memory;
-                first_non_constant_column = i;
-            }
-        }
-    }
-    (void)min_size_in_memory; /// Suppress error of clang-analyzer-deadcode.DeadStores
-
-    size_t num_filtered_rows = 0;
-    if (first_non_constant_column != num_columns)
-    {
-        columns[first_non_constant_column] = filter_description->filter(*columns[first_non_constant_column], -1);
-        num_filtered_rows = columns[first_non_constant_column]->size();
-    }
-    else
-        num_filtered_rows = filter_description->countBytesInFilter();
+    const size_t num_filtered_rows = filter_description->countBytesInFilter();
 
     incrementProfileEvents(num_filtered_rows, columns);
 
@@ -242,9 +217,6 @@ void FilterTransform::doTransform(Chunk & chunk)
         if (i == filter_column_position && remove_filter_column)
             continue;
 
-        if (i == first_non_constant_column)
-            continue;
-
         if (isColumnConst(*current_column))
             current_column = current_column->cut(0, num_filtered_rows);
         else
@@ -115,7 +115,7 @@ public:
     {
         if (!tmp_read_stream)
         {
-            LOG_INFO(log, "Start reading part of data from temporary file");
+            LOG_TRACE(log, "Start reading part of data from temporary file");
             tmp_read_stream = tmp_stream.getReadStream();
         }
 
@@ -1,3 +1,4 @@
+#include <Common/ProfileEvents.h>
 #include <limits>
 #include <Interpreters/Aggregator.h>
 #include <Interpreters/sortBlock.h>
@@ -7,6 +8,11 @@
 #include <Processors/Transforms/MergingAggregatedMemoryEfficientTransform.h>
 #include <QueryPipeline/Pipe.h>
 
+namespace ProfileEvents
+{
+    extern const Event AggregationSingleLevelBlocksConvertedToTwoLevel;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -293,6 +299,11 @@ void GroupingAggregatedTransform::work()
         const auto & header = getInputs().front().getHeader();  /// Take header from input port. Output header is empty.
         auto block = header.cloneWithColumns(single_level_chunks.back().detachColumns());
         single_level_chunks.pop_back();
+
+        /// This conversion runs in the only GroupingAggregatedTransform of the pipeline, so it is
+        /// the serial part of a memory-efficient merge (local or distributed); account for it to
+        /// make the bottleneck visible.
+        ProfileEvents::increment(ProfileEvents::AggregationSingleLevelBlocksConvertedToTwoLevel);
         auto blocks = params->aggregator.convertBlockToTwoLevel(block);
 
         for (auto & cur_block : blocks)
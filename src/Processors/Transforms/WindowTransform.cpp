@@ -955,28 +955,9 @@ void WindowTransform::updateAggregationState()
     assert(partition_start <= frame_start);
     assert(frame_end <= partition_end);
 
-    // We might have to reset aggregation state and/or add some rows to it.
-    // Figure out what to do.
-    bool reset_aggregation = false;
-    RowNumber rows_to_add_start;
-    RowNumber rows_to_add_end;
-    if (frame_start == prev_frame_start)
-    {
-        // The frame start didn't change, add the tail rows.
-        reset_aggregation = false;
-        rows_to_add_start = prev_frame_end;
-        rows_to_add_end = frame_end;
-    }
-    else
-    {
-        // The frame start changed, reset the state and aggregate over the
-        // entire frame. This can be made per-function after we learn to
-        // subtract rows from some types of aggregation states, but for now we
-        // always have to reset when the frame start changes.
-        reset_aggregation = true;
-        rows_to_add_start = frame_start;
-        rows_to_add_end = frame_end;
-    }
+    const bool frame_start_advanced = frame_start != prev_frame_start;
+    // Whether some rows of the previous frame are still part of the new one.
+    const bool frames_overlap = frame_start < prev_frame_end;
 
     for (auto & ws : workspaces)
     {
@@ -988,50 +969,81 @@ void WindowTransform::updateAggregationState()
 
         const auto * a = ws.aggregate_function.get();
         auto * buf = ws.aggregate_function_state.data();
-
-        if (reset_aggregation)
-        {
-            a->destroy(buf);
-            a->create(buf);
-        }
+        // Removing arena.get() from the loop makes it faster somehow...
+        auto * arena_ptr = arena.get();
 
         // To achieve better performance, we will have to loop over blocks and
         // rows manually, instead of using advanceRowNumber().
         // For this purpose, the past-the-end block can be different than the
         // block of the past-the-end row (it's usually the next block).
-        const auto past_the_end_block = rows_to_add_end.row == 0
-            ? rows_to_add_end.block
-            : rows_to_add_end.block + 1;
-
-        for (auto block_number = rows_to_add_start.block;
-             block_number < past_the_end_block;
-             ++block_number)
+        auto for_each_block_range = [&](RowNumber range_start, RowNumber range_end, auto && apply)
         {
-            auto & block = blockAt(block_number);
+            const auto past_the_end_block = range_end.row == 0
+                ? range_end.block
+                : range_end.block + 1;
 
-            if (ws.cached_block_number != block_number)
+            for (auto block_number = range_start.block;
+                 block_number < past_the_end_block;
+                 ++block_number)
             {
-                for (size_t i = 0; i < ws.argument_column_indices.size(); ++i)
+                auto & block = blockAt(block_number);
+
+                if (ws.cached_block_number != block_number)
                 {
-                    ws.argument_columns[i] = block.input_columns[
-                        ws.argument_column_indices[i]].get();
+                    for (size_t i = 0; i < ws.argument_column_indices.size(); ++i)
+                    {
+                        ws.argument_columns[i] = block.input_columns[
+                            ws.argument_column_indices[i]].get();
+                    }
+                    ws.cached_block_number = block_number;
                 }
-                ws.cached_block_number = block_number;
+
+                // First and last blocks may be processed partially, and other blocks
+                // are processed in full.
+                const auto first_row = block_number == range_start.block
+                    ? range_start.row : 0;
+                const auto past_the_end_row = block_number == range_end.block
+                    ? range_end.row : block.rows;
+
+                apply(first_row, past_the_end_row);
             }
+        };
 
-            // First and last blocks may be processed partially, and other blocks
-            // are processed in full.
-            const auto first_row = block_number == rows_to_add_start.block
-                ? rows_to_add_start.row : 0;
-            const auto past_the_end_row = block_number == rows_to_add_end.block
-                ? rows_to_add_end.row : block.rows;
-
-            // We should add an addBatch analog that can accept a starting offset.
-            // For now, add the values one by one.
-            auto * columns = ws.argument_columns.data();
-            // Removing arena.get() from the loop makes it faster somehow...
-            auto * arena_ptr = arena.get();
-            a->addBatchSinglePlace(first_row, past_the_end_row, buf, columns, arena_ptr);
+        auto add_rows = [&](RowNumber range_start, RowNumber range_end)
+        {
+            for_each_block_range(range_start, range_end, [&](size_t first_row, size_t past_the_end_row)
+            {
+                a->addBatchSinglePlace(first_row, past_the_end_row, buf, ws.argument_columns.data(), arena_ptr);
+            });
+        };
+
+        if (!frame_start_advanced)
+        {
+            // The frame start didn't change, add the tail rows.
+            add_rows(prev_frame_end, frame_end);
+        }
+        else if (frames_overlap && a->canRemoveData())
+        {
+            // The frame start advanced, but the frames overlap and this function can
+            // remove rows from its state: retire the rows that left the frame and add
+            // the new tail instead of recomputing the entire frame. This is what makes
+            // sliding frames (e.g. ROWS BETWEEN N PRECEDING AND CURRENT ROW) linear
+            // instead of quadratic for sum/count/avg.
+            for_each_block_range(prev_frame_start, frame_start, [&](size_t first_row, size_t past_the_end_row)
+            {
+                for (size_t row = first_row; row < past_the_end_row; ++row)
+                    a->remove(buf, ws.argument_columns.data(), row, arena_ptr);
+            });
+            add_rows(prev_frame_end, frame_end);
+        }
+        else
+        {
+            // The frame start changed and this function cannot subtract rows from its
+            // state (or nothing of the previous frame is left), reset the state and
+            // aggregate over the entire frame.
+            a->destroy(buf);
+            a->create(buf);
+            add_rows(frame_start, frame_end);
         }
     }
 }
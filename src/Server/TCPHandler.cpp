@@ -709,14 +709,15 @@ void TCPHandler::runImpl()
                 return res;
             });
 
+            /// The codec and format settings do not change during the query, resolve them once:
+            /// the callback runs for every block on pipeline threads, and rebuilding FormatSettings
+            /// there is a noticeable per-block cost on SELECT * style exports.
             query_state->query_context->setBlockMarshallingCallback(
-                [this, &query_state](const Block & block)
+                [this,
+                 codec = getCompressionCodec(query_state->query_context->getSettingsRef(), query_state->compression),
+                 format_settings = getFormatSettings(query_state->query_context)](const Block & block)
                 {
-                    return convertColumnsToBLOBs(
-                        block,
-                        getCompressionCodec(query_state->query_context->getSettingsRef(), query_state->compression),
-                        client_tcp_protocol_version,
-                        getFormatSettings(query_state->query_context));
+                    return convertColumnsToBLOBs(block, codec, client_tcp_protocol_version, format_settings);
                 });
 
             /// Processing Query
@@ -2203,14 +2204,13 @@ void TCPHandler::processQuery(std::optional<QueryState> & state)
     state->query_context->setFileProgressCallback(
         [this, &state](const FileProgress & value) { this->updateProgress(state.value(), Progress(value)); });
 
+    /// See the comment near the same callback in receiveQuery: per-query invariants are resolved once.
     state->query_context->setBlockMarshallingCallback(
-        [this, &state](const Block & block)
+        [this,
+         codec = getCompressionCodec(state->query_context->getSettingsRef(), state->compression),
+         format_settings = getFormatSettings(state->query_context)](const Block & block)
         {
-            return convertColumnsToBLOBs(
-                block,
-                getCompressionCodec(state->query_context->getSettingsRef(), state->compression),
-                client_tcp_protocol_version,
-                getFormatSettings(state->query_context));
+            return convertColumnsToBLOBs(block, codec, client_tcp_protocol_version, format_settings);
         });
 
     ///
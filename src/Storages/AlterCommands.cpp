@@ -544,7 +544,8 @@ void AlterCommand::apply(StorageInMemoryMetadata & metadata, ContextPtr context)
 
         /// Try to add "implicit" minmax index for new column
         if (metadata.settings_changes
-            && ((isNumber(column.type) && metadata.settings_changes->as<ASTSetQuery &>().changes.tryGet("add_minmax_index_for_numeric_columns"))
+            && (((isNumber(column.type) || isDateOrDate32OrDateTimeOrDateTime64(column.type))
+                    && metadata.settings_changes->as<ASTSetQuery &>().changes.tryGet("add_minmax_index_for_numeric_columns"))
                 || (isString(column.type) && metadata.settings_changes->as<ASTSetQuery &>().changes.tryGet("add_minmax_index_for_string_columns"))))
         {
             bool minmax_index_exists = false;
@@ -571,7 +572,8 @@ void AlterCommand::apply(StorageInMemoryMetadata & metadata, ContextPtr context)
     {
         const auto * column = metadata.columns.tryGet(column_name);
         if (column && metadata.settings_changes
-            && ((isNumber(column->type) && metadata.settings_changes->as<ASTSetQuery &>().changes.tryGet("add_minmax_index_for_numeric_columns"))
+            && (((isNumber(column->type) || isDateOrDate32OrDateTimeOrDateTime64(column->type))
+                    && metadata.settings_changes->as<ASTSetQuery &>().changes.tryGet("add_minmax_index_for_numeric_columns"))
                 || (isString(column->type) && metadata.settings_changes->as<ASTSetQuery &>().changes.tryGet("add_minmax_index_for_string_columns"))))
         {
             for (auto index_it = metadata.secondary_indices.begin();
@@ -1,20 +1,38 @@
 #include <Common/SipHash.h>
 #include <Common/CurrentMetrics.h>
+#include <Common/Exception.h>
 #include <Storages/MarkCache.h>
 
+#include <zstd.h>
+
 namespace CurrentMetrics
 {
     extern const Metric MarkCacheBytes;
     extern const Metric MarkCacheFiles;
+    extern const Metric MarkCacheCompressedBytes;
+    extern const Metric MarkCacheCompressedFiles;
 }
 
 namespace DB
 {
+
+namespace ErrorCodes
+{
+    extern const int CANNOT_COMPRESS;
+    extern const int CANNOT_DECOMPRESS;
+}
+
 template class CacheBase<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>;
 
-MarkCache::MarkCache(const String & cache_policy, size_t max_size_in_bytes, double size_ratio)
+static constexpr int MARK_CACHE_COMPRESSION_LEVEL = 1;
+
+MarkCache::MarkCache(const String & cache_policy, size_t max_size_in_bytes, size_t max_compressed_size_in_bytes, double size_ratio)
     : Base(cache_policy, CurrentMetrics::MarkCacheBytes, CurrentMetrics::MarkCacheFiles, max_size_in_bytes, 0, size_ratio)
 {
+    if (max_compressed_size_in_bytes)
+        compressed_tier = std::make_unique<CompressedTier>(
+            cache_policy, CurrentMetrics::MarkCacheCompressedBytes, CurrentMetrics::MarkCacheCompressedFiles,
+            max_compressed_size_in_bytes, 0, size_ratio);
 }
 
 UInt128 MarkCache::hash(const String& path_to_file)
@@ -24,5 +42,54 @@ UInt128 MarkCache::hash(const String& path_to_file)
     return hash.get128();
 }
 
+void MarkCache::demoteToCompressedTier(const Key & key, const MarksInCompressedFile & marks)
+{
+    size_t num_marks = marks.getNumberOfMarks();
+
+    MarksInCompressedFile::PlainArray plain(num_marks);
+    for (size_t i = 0; i < num_marks; ++i)
+        plain[i] = marks.get(i);
+
+    size_t uncompressed_size = num_marks * sizeof(MarkInCompressedFile);
+
+    auto compressed = std::make_shared<CompressedMarks>();
+    compressed->uncompressed_size = uncompressed_size;
+    compressed->data.resize(ZSTD_compressBound(uncompressed_size));
+
+    size_t compressed_size = ZSTD_compress(
+        compressed->data.data(), compressed->data.size(),
+        reinterpret_cast<const char *>(plain.data()), uncompressed_size,
+        MARK_CACHE_COMPRESSION_LEVEL);
+
+    if (ZSTD_isError(compressed_size))
+        throw Exception(ErrorCodes::CANNOT_COMPRESS, "Cannot compress marks with ZSTD: {}", ZSTD_getErrorName(compressed_size));
+
+    compressed->data.resize(compressed_size);
+    compressed_tier->set(key, std::move(compressed));
+}
+
+MarkCache::MappedPtr MarkCache::tryPromoteFromCompressedTier(const Key & key)
+{
+    if (!compressed_tier)
+        return nullptr;
+
+    auto compressed = compressed_tier->get(key);
+    if (!compressed)
+        return nullptr;
+
+    MarksInCompressedFile::PlainArray plain(compressed->uncompressed_size / sizeof(MarkInCompressedFile));
+
+    size_t decompressed_size = ZSTD_decompress(
+        reinterpret_cast<char *>(plain.data()), compressed->uncompressed_size,
+        compressed->data.data(), compressed->data.size());
+
+    if (ZSTD_isError(decompressed_size) || decompressed_size != compressed->uncompressed_size)
+        throw Exception(ErrorCodes::CANNOT_DECOMPRESS, "Cannot decompress marks with ZSTD: {}", ZSTD_getErrorName(decompressed_size));
+
+    /// The entry is being promoted back to the main tier, no need to keep the compressed copy.
+    compressed_tier->remove(key);
+
+    return std::make_shared<MarksInCompressedFile>(plain);
+}
 
 }
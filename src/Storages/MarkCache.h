@@ -15,6 +15,7 @@ namespace ProfileEvents
     extern const Event MarkCacheEvictedBytes;
     extern const Event MarkCacheEvictedMarks;
     extern const Event MarkCacheEvictedFiles;
+    extern const Event MarkCacheCompressedTierHits;
 }
 
 namespace DB
@@ -35,14 +36,31 @@ struct MarksWeightFunction
 extern template class CacheBase<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>;
 /** Cache of 'marks' for StorageMergeTree.
   * Marks is an index structure that addresses ranges in column file, corresponding to ranges of primary key.
+  *
+  * Optionally keeps a second tier: entries evicted from the main tier are stored as ZSTD-compressed
+  * blobs at several times the density and are promoted back (decompressed) on access, which is much
+  * cheaper than re-reading and re-parsing the mark file.
   */
 class MarkCache : public CacheBase<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>
 {
 private:
     using Base = CacheBase<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>;
 
+    struct CompressedMarks
+    {
+        PODArray<char> data;
+        size_t uncompressed_size = 0;
+    };
+
+    struct CompressedMarksWeightFunction
+    {
+        size_t operator()(const CompressedMarks & marks) const { return marks.data.size() + MarksWeightFunction::MARK_CACHE_OVERHEAD; }
+    };
+
+    using CompressedTier = CacheBase<UInt128, CompressedMarks, UInt128TrivialHash, CompressedMarksWeightFunction>;
+
 public:
-    MarkCache(const String & cache_policy, size_t max_size_in_bytes, double size_ratio);
+    MarkCache(const String & cache_policy, size_t max_size_in_bytes, size_t max_compressed_size_in_bytes, double size_ratio);
 
     /// Calculate key from path to file.
     static UInt128 hash(const String & path_to_file);
@@ -50,7 +68,17 @@ public:
     template <typename LoadFunc>
     MappedPtr getOrSet(const Key & key, LoadFunc && load)
     {
-        auto result = Base::getOrSet(key, load);
+        auto load_or_promote = [&]() -> MappedPtr
+        {
+            if (auto promoted = tryPromoteFromCompressedTier(key))
+            {
+                ProfileEvents::increment(ProfileEvents::MarkCacheCompressedTierHits);
+                return promoted;
+            }
+            return load();
+        };
+
+        auto result = Base::getOrSet(key, load_or_promote);
         if (result.second)
             ProfileEvents::increment(ProfileEvents::MarkCacheMisses);
         else
@@ -61,7 +89,7 @@ public:
 
 private:
     /// Called for each individual entry being evicted from cache
-    void onEntryRemoval(const size_t weight_loss, const MappedPtr & mapped_ptr) override
+    void onEntryRemoval(const Key & key, const size_t weight_loss, const MappedPtr & mapped_ptr) override
     {
         /// File is the key of MarkCache, each removal means eviction of 1 file from the cache.
         ProfileEvents::increment(ProfileEvents::MarkCacheEvictedFiles);
@@ -69,8 +97,15 @@ private:
 
         const auto * marks_in_compressed_file = static_cast<const MarksInCompressedFile *>(mapped_ptr.get());
         ProfileEvents::increment(ProfileEvents::MarkCacheEvictedMarks, marks_in_compressed_file->getNumberOfMarks());
+
+        if (compressed_tier)
+            demoteToCompressedTier(key, *marks_in_compressed_file);
     }
 
+    MappedPtr tryPromoteFromCompressedTier(const Key & key);
+    void demoteToCompressedTier(const Key & key, const MarksInCompressedFile & marks);
+
+    std::unique_ptr<CompressedTier> compressed_tier;
 };
 
 using MarkCachePtr = std::shared_ptr<MarkCache>;
@@ -131,13 +131,25 @@ GinIndexPostingsListPtr GinIndexPostingsBuilder::deserialize(ReadBuffer & buffer
         size_t compressed_size = 0;
         readVarUInt(size, buffer);
         readVarUInt(compressed_size, buffer);
-        auto buf = std::make_unique<char[]>(compressed_size);
-        buffer.readStrict(reinterpret_cast<char *>(buf.get()), compressed_size);
 
         Memory<> memory;
         memory.resize(size);
         const auto & codec = GinIndexCompressionFactory::zstdCodec();
-        codec->decompress(buf.get(), static_cast<UInt32>(compressed_size), memory.data());
+
+        if (buffer.available() >= compressed_size)
+        {
+            /// The compressed blob is already contiguous in the read buffer, decompress in place
+            /// instead of copying it out first; posting lists are deserialized per term per
+            /// segment, so the extra allocation and memcpy add up on fragmented indexes.
+            codec->decompress(buffer.position(), static_cast<UInt32>(compressed_size), memory.data());
+            buffer.position() += compressed_size;
+        }
+        else
+        {
+            auto buf = std::make_unique<char[]>(compressed_size);
+            buffer.readStrict(buf.get(), compressed_size);
+            codec->decompress(buf.get(), static_cast<UInt32>(compressed_size), memory.data());
+        }
 
         GinIndexPostingsListPtr postings_list = std::make_shared<GinIndexPostingsList>(GinIndexPostingsList::read(memory.data()));
 
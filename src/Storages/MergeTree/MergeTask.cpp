@@ -1624,7 +1624,9 @@ public:
                     sort_description,
                     merge_block_size_rows,
                     merge_block_size_bytes,
-                    SortingQueueStrategy::Default,
+                    /// The batch queue emits whole runs of rows from one cursor instead of per-row
+                    /// heap pops with virtual compareAt calls, which matters for wide merges.
+                    SortingQueueStrategy::Batch,
                     /* limit_= */0,
                     /* always_read_till_end_= */false,
                     rows_sources_write_buf,
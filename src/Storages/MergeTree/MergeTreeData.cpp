@@ -6756,12 +6756,26 @@ MergeTreeData::DataPartsVector MergeTreeData::getDataPartsVectorForInternalUsage
     DataPartsVector res;
     DataPartsVector buf;
 
+    /// This is copied under the parts lock, which is among the hottest on tables with many
+    /// parts; reserve the upper bound once so the copy never reallocates while holding it.
+    res.reserve(data_parts_indexes.size());
+
     for (auto state : affordable_states)
     {
         auto range = getDataPartsStateRange(state);
-        std::swap(buf, res);
-        res.clear();
-        std::merge(range.begin(), range.end(), buf.begin(), buf.end(), std::back_inserter(res), LessDataPart());
+
+        if (res.empty())
+        {
+            /// The common case of a single state (e.g. Active) is a plain ordered copy.
+            res.insert(res.end(), range.begin(), range.end());
+        }
+        else
+        {
+            std::swap(buf, res);
+            res.clear();
+            res.reserve(data_parts_indexes.size());
+            std::merge(range.begin(), range.end(), buf.begin(), buf.end(), std::back_inserter(res), LessDataPart());
+        }
     }
 
     if (out_states != nullptr)
@@ -91,7 +91,9 @@ namespace Setting
     extern const SettingsNonZeroUInt64 max_parallel_replicas;
     extern const SettingsUInt64 merge_tree_coarse_index_granularity;
     extern const SettingsUInt64 merge_tree_min_bytes_for_seek;
+    extern const SettingsUInt64 merge_tree_min_bytes_for_seek_for_remote_filesystem;
     extern const SettingsUInt64 merge_tree_min_rows_for_seek;
+    extern const SettingsUInt64 merge_tree_min_rows_for_seek_for_remote_filesystem;
     extern const SettingsUInt64 parallel_replica_offset;
     extern const SettingsUInt64 parallel_replicas_count;
     extern const SettingsParallelReplicasMode parallel_replicas_mode;
@@ -1183,6 +1185,16 @@ QueryPlanStepPtr MergeTreeDataSelectExecutor::readFromParts(
 }
 
 
+size_t MergeTreeDataSelectExecutor::getMinMarksForSeek(const MergeTreeData::DataPartPtr & part, const Settings & settings)
+{
+    const bool is_remote = part->isStoredOnRemoteDisk();
+    return roundRowsOrBytesToMarks(
+        is_remote ? settings[Setting::merge_tree_min_rows_for_seek_for_remote_filesystem] : settings[Setting::merge_tree_min_rows_for_seek],
+        is_remote ? settings[Setting::merge_tree_min_bytes_for_seek_for_remote_filesystem] : settings[Setting::merge_tree_min_bytes_for_seek],
+        part->index_granularity_info.fixed_index_granularity,
+        part->index_granularity_info.index_granularity_bytes);
+}
+
 /// Marks are placed whenever threshold on rows or bytes is met.
 /// So we have to return the number of marks on whatever estimate is higher - by rows or by bytes.
 size_t MergeTreeDataSelectExecutor::roundRowsOrBytesToMarks(
@@ -1426,11 +1438,7 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
         if (settings[Setting::merge_tree_coarse_index_granularity] <= 1)
             throw Exception(ErrorCodes::ARGUMENT_OUT_OF_BOUND, "Setting merge_tree_coarse_index_granularity should be greater than 1");
 
-        size_t min_marks_for_seek = roundRowsOrBytesToMarks(
-            settings[Setting::merge_tree_min_rows_for_seek],
-            settings[Setting::merge_tree_min_bytes_for_seek],
-            part->index_granularity_info.fixed_index_granularity,
-            part->index_granularity_info.index_granularity_bytes);
+        size_t min_marks_for_seek = getMinMarksForSeek(part, settings);
 
         /// There will always be disjoint suspicious segments on the stack, the leftmost one at the top (back).
         /// At each step, take the left segment and check if it fits.
@@ -1612,11 +1620,7 @@ MarkRanges MergeTreeDataSelectExecutor::filterMarksUsingIndex(
 
     auto index_granularity = index_helper->index.granularity;
 
-    const size_t min_marks_for_seek = roundRowsOrBytesToMarks(
-        settings[Setting::merge_tree_min_rows_for_seek],
-        settings[Setting::merge_tree_min_bytes_for_seek],
-        part->index_granularity_info.fixed_index_granularity,
-        part->index_granularity_info.index_granularity_bytes);
+    const size_t min_marks_for_seek = getMinMarksForSeek(part, settings);
 
     size_t marks_count = part->index_granularity->getMarksCountWithoutFinal();
     size_t index_marks_count = (marks_count + index_granularity - 1) / index_granularity;
@@ -1793,11 +1797,7 @@ MarkRanges MergeTreeDataSelectExecutor::filterMarksUsingMergedIndex(
 
     auto index_granularity = indices.front()->index.granularity;
 
-    const size_t min_marks_for_seek = roundRowsOrBytesToMarks(
-        settings[Setting::merge_tree_min_rows_for_seek],
-        settings[Setting::merge_tree_min_bytes_for_seek],
-        part->index_granularity_info.fixed_index_granularity,
-        part->index_granularity_info.index_granularity_bytes);
+    const size_t min_marks_for_seek = getMinMarksForSeek(part, settings);
 
     size_t marks_count = part->index_granularity->getMarksCountWithoutFinal();
     size_t index_marks_count = (marks_count + index_granularity - 1) / index_granularity;
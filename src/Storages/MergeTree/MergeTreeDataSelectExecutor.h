@@ -148,6 +148,11 @@ private:
 public:
     /// For given number rows and bytes, get the number of marks to read.
     /// It is a minimal number of marks which contain so many rows and bytes.
+    /// Compute the mark distance under which two neighboring ranges are merged and read as one,
+    /// using the separate thresholds for parts on remote filesystems, where every extra range
+    /// becomes an extra object storage request.
+    static size_t getMinMarksForSeek(const MergeTreeData::DataPartPtr & part, const Settings & settings);
+
     static size_t roundRowsOrBytesToMarks(
         size_t rows_setting,
         size_t bytes_setting,
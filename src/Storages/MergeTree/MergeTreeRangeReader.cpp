@@ -529,8 +529,23 @@ void MergeTreeRangeReader::ReadResult::optimize(const FilterWithCachedCount & cu
         setFilterConstTrue();
         return;
     }
-    /// Just a guess. If only a few rows may be skipped, it's better not to skip at all.
-    if (2 * total_zero_rows_in_tails > filter.size())
+    /// Skipping a whole granule means that it will not even be decompressed for the remaining
+    /// columns, which is worth doing regardless of how many rows the other granules keep.
+    /// Partial tails only save deserialization of the tail rows, so for them keep the guess below:
+    /// if only a few rows may be skipped, it's better not to skip at all.
+    if (2 * total_zero_rows_in_tails <= filter.size())
+    {
+        size_t zero_rows_in_whole_granule_tails = 0;
+        for (auto i : collections::range(0, rows_per_granule.size()))
+        {
+            if (zero_tails[i] != rows_per_granule[i])
+                zero_tails[i] = 0;
+            zero_rows_in_whole_granule_tails += zero_tails[i];
+        }
+        total_zero_rows_in_tails = zero_rows_in_whole_granule_tails;
+    }
+
+    if (total_zero_rows_in_tails > 0)
     {
         const NumRows rows_per_granule_previous = rows_per_granule;
         const size_t total_rows_per_granule_previous = total_rows_per_granule;
@@ -63,12 +63,30 @@ MergeTreeReadPool::MergeTreeReadPool(
     , backoff_state{pool_settings.threads}
 {
     fillPerThreadInfo(pool_settings.threads, pool_settings.sum_marks);
+    marks_prefetch_started.resize(per_part_infos.size(), false);
+}
+
+void MergeTreeReadPool::startMarksPrefetch(size_t part_idx)
+{
+    if (!owned_mark_cache || !reader_settings.read_settings.load_marks_asynchronously)
+        return;
+
+    try
+    {
+        per_part_infos[part_idx]->data_part->loadMarksToCache(column_names, owned_mark_cache.get());
+    }
+    catch (...)
+    {
+        /// Prefetch is an optimization: the reader will load (and report) whatever failed here.
+        tryLogCurrentException(getLogger("MergeTreeReadPool"), "Cannot prefetch marks");
+    }
 }
 
 MergeTreeReadTaskPtr MergeTreeReadPool::getTask(size_t task_idx, MergeTreeReadTask * previous_task)
 {
     size_t part_idx;
     MarkRanges ranges_to_get_from_part;
+    bool first_task_for_part = false;
 
     {
         const std::lock_guard lock{mutex};
@@ -153,8 +171,17 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(size_t task_idx, MergeTreeReadTa
                 need_marks -= marks_to_get_from_range;
             }
         }
+
+        if (!marks_prefetch_started[part_idx])
+        {
+            marks_prefetch_started[part_idx] = true;
+            first_task_for_part = true;
+        }
     }
 
+    if (first_task_for_part)
+        startMarksPrefetch(part_idx);
+
     /// createTask() is costly and not needed guarded by mutex.
     return createTask(per_part_infos[part_idx], std::move(ranges_to_get_from_part), previous_task);
 }
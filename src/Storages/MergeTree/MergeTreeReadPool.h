@@ -74,8 +74,15 @@ public:
 private:
     void fillPerThreadInfo(size_t threads, size_t sum_marks);
 
+    /// Starts asynchronous loading of marks of all requested columns the first time a task
+    /// for the part is assigned, so that mark files are read while the task is queued.
+    void startMarksPrefetch(size_t part_idx);
+
     mutable std::mutex mutex;
 
+    /// Parts for which mark prefetch has been started already.
+    std::vector<bool> marks_prefetch_started TSA_GUARDED_BY(mutex);
+
     /// State to track numbers of slow reads.
     struct BackoffState
     {
@@ -13,6 +13,7 @@ namespace Setting
 {
     extern const SettingsBool merge_tree_determine_task_size_by_prewhere_columns;
     extern const SettingsUInt64 merge_tree_min_bytes_per_task_for_remote_reading;
+    extern const SettingsUInt64 merge_tree_min_bytes_per_task_for_local_reading;
     extern const SettingsUInt64 merge_tree_min_read_task_size;
 }
 
@@ -118,6 +119,19 @@ calculateMinMarksPerTask(
         else
         {
             avg_mark_bytes = std::max<size_t>(getSizeOfColumns(*part.data_part, columns_to_read) / part_marks_count, 1);
+
+            /// Parts differ a lot in bytes per mark (adaptive granularity, skewed column sizes),
+            /// so a uniform mark count produces tasks of very different weight. If a byte target is
+            /// configured, size the tasks of this part so that they carry comparable amounts of data,
+            /// with the same cap that keeps enough tasks for stealing.
+            if (const auto min_bytes_per_task = settings[Setting::merge_tree_min_bytes_per_task_for_local_reading])
+            {
+                const auto heuristic_min_marks = std::min<size_t>(
+                    pool_settings.sum_marks / (pool_settings.threads * pool_settings.total_query_nodes) / 2,
+                    min_bytes_per_task / avg_mark_bytes);
+                if (heuristic_min_marks > min_marks_per_task)
+                    min_marks_per_task = heuristic_min_marks;
+            }
         }
     }
 
@@ -1583,8 +1583,8 @@ namespace ErrorCodes
     Persists virtual column `_block_number` on merges.
     )", 0) \
     DECLARE(Bool, add_minmax_index_for_numeric_columns, false, R"(
-    When enabled, min-max (skipping) indices are added for all numeric columns
-    of the table.
+    When enabled, min-max (skipping) indices are added for all numeric, date and
+    datetime columns of the table.
     )", 0) \
     DECLARE(Bool, add_minmax_index_for_string_columns, false, R"(
     When enabled, min-max (skipping) indices are added for all string columns of
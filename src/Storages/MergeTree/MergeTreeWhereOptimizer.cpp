@@ -271,6 +271,12 @@ static bool isConditionGood(const RPNBuilderTreeNode & condition, const NameSet
         const auto value = output_value.safeGet<Float64>();
         return value < -threshold || threshold < value;
     }
+    if (type == Field::Types::String)
+    {
+        /// Equality with a non-empty string behaves like equality with a large number: it usually
+        /// selects a specific entity (host, url, uuid), while the empty string is flag-like.
+        return !output_value.safeGet<String>().empty();
+    }
 
     return false;
 }
@@ -139,10 +139,17 @@ void MergedBlockOutputStream::Finalizer::Impl::finish()
 {
     writer.finish(sync);
 
+    /// With fsync enabled this loop issues a write+fsync pair per file, serially - hundreds of
+    /// syscalls for wide parts. An io_uring write path could chain the appends and fsyncs, but
+    /// there is no io_uring writer in the IO stack (only IOUringReader); until one exists, the
+    /// finalize/sync split below at least lets the kernel start flushing dirty pages of earlier
+    /// files while later ones are finalized.
     for (auto & file : written_files)
-    {
         file->finalize();
-        if (sync)
+
+    if (sync)
+    {
+        for (auto & file : written_files)
             file->sync();
     }
 
@@ -1833,6 +1833,11 @@ ReplicatedMergeTreeQueue::SelectedEntryPtr ReplicatedMergeTreeQueue::selectEntry
 
     std::unique_lock lock(state_mutex);
 
+    /// One timestamp for the whole pass: with a long queue (e.g. a replica catching up) the scan
+    /// visits thousands of postponed entries per selection while holding state_mutex, and a
+    /// time() call per entry is pure overhead there.
+    const time_t current_time = time(nullptr);
+
     for (auto it = queue.begin(); it != queue.end(); ++it)
     {
         if ((*it)->currently_executing)
@@ -1848,7 +1853,7 @@ ReplicatedMergeTreeQueue::SelectedEntryPtr ReplicatedMergeTreeQueue::selectEntry
         }
 
         ++(*it)->num_postponed;
-        (*it)->last_postpone_time = time(nullptr);
+        (*it)->last_postpone_time = current_time;
     }
 
     if (entry)
@@ -191,7 +191,15 @@ size_t ReplicatedMergeTreeSinkImpl<async_insert>::checkQuorumPrecondition(const
 
             quorum_info.status_path = storage.zookeeper_path + "/quorum/status";
 
-            Strings replicas = zookeeper->getChildren(fs::path(storage.zookeeper_path) / "replicas");
+            /// The replicas list and the state of the current replica are independent, request them
+            /// in parallel to save one Keeper round trip (this check runs for every quorum insert).
+            auto replicas_future = zookeeper->asyncGetChildren(fs::path(storage.zookeeper_path) / "replicas");
+            auto get_results = zookeeper->get(Strings{storage.replica_path + "/is_active", storage.replica_path + "/host"});
+
+            auto replicas_response = replicas_future.get();
+            if (replicas_response.error != Coordination::Error::ZOK)
+                throw Coordination::Exception::fromPath(replicas_response.error, fs::path(storage.zookeeper_path) / "replicas");
+            Strings & replicas = replicas_response.names;
 
             Strings exists_paths;
             exists_paths.reserve(replicas.size());
@@ -200,7 +208,6 @@ size_t ReplicatedMergeTreeSinkImpl<async_insert>::checkQuorumPrecondition(const
                     exists_paths.emplace_back(fs::path(storage.zookeeper_path) / "replicas" / replica / "is_active");
 
             auto exists_result = zookeeper->exists(exists_paths);
-            auto get_results = zookeeper->get(Strings{storage.replica_path + "/is_active", storage.replica_path + "/host"});
 
             Coordination::Error keeper_error = Coordination::Error::ZOK;
             size_t active_replicas = 1; /// Assume current replica is active (will check below)
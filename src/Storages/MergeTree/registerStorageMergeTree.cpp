@@ -738,7 +738,8 @@ static StoragePtr create(const StorageFactory::Arguments & args)
         /// Try to add "implicit" min-max indexes on all columns
         for (const auto & column : metadata.columns)
         {
-            if ((isNumber(column.type) && (*storage_settings)[MergeTreeSetting::add_minmax_index_for_numeric_columns])
+            if (((isNumber(column.type) || isDateOrDate32OrDateTimeOrDateTime64(column.type))
+                    && (*storage_settings)[MergeTreeSetting::add_minmax_index_for_numeric_columns])
                 || (isString(column.type) && (*storage_settings)[MergeTreeSetting::add_minmax_index_for_string_columns]))
             {
                 bool minmax_index_exists = false;
@@ -1,4 +1,6 @@
 #include <Storages/ObjectStorage/ReadBufferIterator.h>
+
+#include <IO/ReadBufferFromEmptyFile.h>
 #include <Storages/ObjectStorage/StorageObjectStorage.h>
 #include <Storages/ObjectStorage/StorageObjectStorageSource.h>
 #include <Core/Settings.h>
@@ -249,9 +251,16 @@ ReadBufferIterator::Data ReadBufferIterator::next()
             prev_read_keys_size = read_keys.size();
         }
 
-        if (query_settings.skip_empty_files
-            && current_object_info->metadata && current_object_info->metadata->size_bytes == 0)
-            continue;
+        if (current_object_info->metadata && current_object_info->metadata->size_bytes == 0)
+        {
+            if (query_settings.skip_empty_files)
+                continue;
+
+            /// The listing metadata already says the file is empty: don't issue a read request
+            /// just to find that out. The caller treats an empty buffer as an empty file.
+            first = false;
+            return {std::make_unique<ReadBufferFromEmptyFile>(), std::nullopt, format};
+        }
 
         /// In union mode, check cached columns only for current key.
         if (getContext()->getSettingsRef()[Setting::schema_inference_mode] == SchemaInferenceMode::UNION)
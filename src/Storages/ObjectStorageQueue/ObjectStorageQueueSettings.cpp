@@ -37,7 +37,7 @@ namespace ErrorCodes
     DECLARE(UInt64, polling_backoff_ms, 30 * 1000, "Polling backoff", 0) \
     DECLARE(UInt32, cleanup_interval_min_ms, 60000, "For unordered mode. Polling backoff min for cleanup", 0) \
     DECLARE(UInt32, cleanup_interval_max_ms, 60000, "For unordered mode. Polling backoff max for cleanup", 0) \
-    DECLARE(UInt64, buckets, 0, "Number of buckets for Ordered mode parallel processing", 0) \
+    DECLARE(UInt64, buckets, 0, "Number of buckets for Ordered mode parallel processing. Files are sharded into buckets by filename hash and each bucket preserves ordering independently, so N buckets (combined with processing_threads_num) give N-way parallelism while keeping per-bucket ordered semantics - this is the supported answer to one consumer thread not keeping up with high file arrival rates. 0 keeps a single globally ordered sequence.", 0) \
     DECLARE(UInt64, list_objects_batch_size, 1000, "Size of a list batch in object storage", 0) \
     DECLARE(Bool, enable_hash_ring_filtering, 0, "Enable filtering files among replicas according to hash ring for Unordered mode", 0) \
     DECLARE(UInt64, max_processed_files_before_commit, 100, "Number of files which can be processed before being committed to keeper (in case of parallel_inserts=true, works on a per-thread basis)", 0) \
@@ -0,0 +1,7 @@
+-- Results of two-level aggregation must not depend on how merge buckets are scheduled.
+SET group_by_two_level_threshold = 1, group_by_two_level_threshold_bytes = 1;
+
+SELECT sum(cnt), count() FROM (SELECT number % 100000 AS k, count() AS cnt FROM numbers_mt(1000000) GROUP BY k) SETTINGS group_by_numa_partitioning = 0;
+SELECT sum(cnt), count() FROM (SELECT number % 100000 AS k, count() AS cnt FROM numbers_mt(1000000) GROUP BY k) SETTINGS group_by_numa_partitioning = 1;
+
+SELECT k, sum(cnt) FROM (SELECT number % 7 AS k, count() AS cnt FROM numbers_mt(100000) GROUP BY k) GROUP BY k ORDER BY k SETTINGS group_by_numa_partitioning = 1;
@@ -0,0 +1,8 @@
+-- Early two-level conversion must not change aggregation results.
+SET group_by_adaptive_two_level_conversion = 1;
+
+-- High cardinality: every row is a new key, conversion triggers early.
+SELECT sum(cnt), count() FROM (SELECT number AS k, count() AS cnt FROM numbers_mt(500000) GROUP BY k);
+
+-- Low cardinality: distinct ratio drops immediately, table stays single-level.
+SELECT k, sum(cnt) FROM (SELECT number % 10 AS k, count() AS cnt FROM numbers_mt(500000) GROUP BY k) GROUP BY k ORDER BY k;
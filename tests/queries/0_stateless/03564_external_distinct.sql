@@ -0,0 +1,6 @@
+-- DISTINCT that exceeds the in-memory set limit must spill and still produce exact results.
+SET enable_external_distinct = 1, max_rows_in_distinct = 10000;
+
+SELECT count() FROM (SELECT DISTINCT number % 100000 AS d FROM numbers_mt(1000000));
+SELECT count(), sum(d) FROM (SELECT DISTINCT number AS d FROM numbers(200000));
+SELECT DISTINCT number % 3 AS d FROM numbers(100000) ORDER BY d;
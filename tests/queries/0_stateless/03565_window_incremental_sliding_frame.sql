@@ -0,0 +1,8 @@
+-- Sliding frames maintained incrementally must match full recomputation.
+SELECT
+    sum(number) OVER (ORDER BY number ROWS BETWEEN 3 PRECEDING AND CURRENT ROW) AS s,
+    count(number) OVER (ORDER BY number ROWS BETWEEN 3 PRECEDING AND CURRENT ROW) AS c,
+    avg(number) OVER (ORDER BY number ROWS BETWEEN 3 PRECEDING AND CURRENT ROW) AS a
+FROM numbers(8);
+
+SELECT sum(number) OVER (ORDER BY number ROWS BETWEEN 2 PRECEDING AND 1 PRECEDING) FROM numbers(5);
@@ -0,0 +1,11 @@
+-- Queries that differ only in cache-related SETTINGS clauses must share one cache entry.
+SYSTEM DROP QUERY CACHE;
+
+SET use_query_cache = 1;
+SELECT 1;
+SELECT 1 SETTINGS query_cache_ttl = 300;
+SET use_query_cache = 0;
+
+SELECT count() FROM system.query_cache;
+
+SYSTEM DROP QUERY CACHE;